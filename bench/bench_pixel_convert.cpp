@@ -0,0 +1,138 @@
+// bench/bench_pixel_convert.cpp
+//
+// RGB888 -> RGB565 throughput: scalar reference vs the SIMD kernel, with and without dithering,
+// the 2x2 box downsampler used for cover mip chains, and the scaled blit used for the
+// in-between cover sizes of the carousel animation.
+
+#include "core/pixel_convert.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using core::rgb888_to_rgb565_row;
+using core::rgb888_to_rgb565_row_scalar;
+using core::downsample_2x_32;
+using core::downsample_2x_32_scalar;
+using core::BlitFilter;
+using core::BlitRect;
+using core::scale_blit_16;
+using core::scale_blit_32;
+using core::scale_blit_32_scalar;
+using core::blend_argb_32;
+using core::blend_argb_32_scalar;
+using core::blend_color_32;
+using core::blend_color_32_scalar;
+using core::blend_color_565;
+using core::blend_color_565_scalar;
+
+template <typename F>
+static double mpix_per_s(int w, int h, int iters, F &&fn) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < iters; ++i)
+    for (int y = 0; y < h; ++y) fn(y);
+  auto t1 = std::chrono::steady_clock::now();
+  double s = std::chrono::duration<double>(t1 - t0).count();
+  return static_cast<double>(w) * h * iters / s / 1e6;
+}
+
+int main() {
+  const int w = 1920, h = 1080, iters = 20;
+  std::vector<uint8_t> src(static_cast<size_t>(w) * h * 3);
+  for (size_t i = 0; i < src.size(); ++i) src[i] = static_cast<uint8_t>(i * 7);
+  std::vector<uint16_t> dst(static_cast<size_t>(w) * h);
+
+  for (int dither = 0; dither < 2; ++dither) {
+    auto row = [&](bool simd) {
+      return [&, simd](int y) {
+        const uint8_t *s = src.data() + static_cast<size_t>(y) * w * 3;
+        uint16_t *d = dst.data() + static_cast<size_t>(y) * w;
+        if (simd) rgb888_to_rgb565_row(s, d, w, dither != 0, y);
+        else rgb888_to_rgb565_row_scalar(s, d, w, dither != 0, y);
+      };
+    };
+    double scalar = mpix_per_s(w, h, iters, row(false));
+    double simd = mpix_per_s(w, h, iters, row(true));
+    std::printf("dither=%d  scalar %8.1f Mpix/s  simd %8.1f Mpix/s  (x%.1f)\n", dither, scalar, simd, simd / scalar);
+  }
+
+  // Mip level 0 -> 1 of an active-size cover (Mpix/s counted on the source)
+  const int cw = 400, ch = 540, citers = 500;
+  std::vector<uint8_t> cover(static_cast<size_t>(cw) * ch * 4);
+  for (size_t i = 0; i < cover.size(); ++i) cover[i] = static_cast<uint8_t>(i * 13);
+  std::vector<uint8_t> half(static_cast<size_t>(cw / 2) * (ch / 2) * 4);
+  // one output row pair per call: rows 2y, 2y+1 -> dst row y
+  auto down = [&](bool simd) {
+    return [&, simd](int y) {
+      const uint8_t *s = cover.data() + static_cast<size_t>(2 * y) * cw * 4;
+      uint8_t *d = half.data() + static_cast<size_t>(y) * (cw / 2) * 4;
+      if (simd) downsample_2x_32(s, cw, 2, cw * 4, d, cw / 2 * 4);
+      else downsample_2x_32_scalar(s, cw, 2, cw * 4, d, cw / 2 * 4);
+    };
+  };
+  double scalar = mpix_per_s(cw, ch / 2, citers, down(false)) * 2;
+  double simd = mpix_per_s(cw, ch / 2, citers, down(true)) * 2;
+  std::printf("box 2x2   scalar %8.1f Mpix/s  simd %8.1f Mpix/s  (x%.1f)\n", scalar, simd, simd / scalar);
+
+  // Cover scaled into a 640x480 frame at an in-between animation size (0.89x) and upscaled
+  // (1.3x, partly clipped). Reported per blit and as covers per 60 fps frame budget.
+  const int fw = 640, fh = 480, biters = 300;
+  std::vector<uint8_t> frame(static_cast<size_t>(fw) * fh * 4);
+  std::vector<uint8_t> cover16(static_cast<size_t>(cw) * ch * 2, 0x5A);
+  const BlitRect screen{0, 0, fw, fh};
+  const BlitRect sizes[] = {{50, 0, 356, 480}, {-60, -100, 520, 702}};
+  for (const BlitRect &to : sizes) {
+    for (int mode = 0; mode < 4; ++mode) {
+      const BlitFilter f = mode & 1 ? BlitFilter::BILINEAR : BlitFilter::NEAREST;
+      const bool simd = mode & 2;
+      auto t0 = std::chrono::steady_clock::now();
+      for (int i = 0; i < biters; ++i) {
+        if (simd) scale_blit_32(cover.data(), cw, ch, cw * 4, frame.data(), fw * 4, to, screen, f);
+        else scale_blit_32_scalar(cover.data(), cw, ch, cw * 4, frame.data(), fw * 4, to, screen, f);
+      }
+      double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / biters;
+      std::printf("blit32 %3dx%3d %-8s %-6s %6.3f ms  (%5.1f per 16.7ms frame)\n", to.w, to.h,
+                  f == BlitFilter::BILINEAR ? "bilinear" : "nearest", simd ? "simd" : "scalar", ms, 16.7 / ms);
+    }
+    for (BlitFilter f : {BlitFilter::NEAREST, BlitFilter::BILINEAR}) {
+      auto t0 = std::chrono::steady_clock::now();
+      for (int i = 0; i < biters; ++i)
+        scale_blit_16(cover16.data(), cw, ch, cw * 2, frame.data(), fw * 2, to, screen, f);
+      double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / biters;
+      std::printf("blit16 %3dx%3d %-8s %-6s %6.3f ms  (%5.1f per 16.7ms frame)\n", to.w, to.h,
+                  f == BlitFilter::BILINEAR ? "bilinear" : "nearest", "swar", ms, 16.7 / ms);
+    }
+  }
+  // Translucent overlay over the whole 640x480 frame, a masked glow and a text-sized ARGB sprite
+  const int oiters = 300;
+  std::vector<uint8_t> glow_mask(static_cast<size_t>(fw) * fh);
+  for (size_t i = 0; i < glow_mask.size(); ++i) glow_mask[i] = static_cast<uint8_t>(i * 7);
+  std::vector<uint8_t> sprite(static_cast<size_t>(fw) * fh * 4);
+  for (size_t i = 0; i < sprite.size(); ++i) sprite[i] = static_cast<uint8_t>(i * 29);
+  auto time_ms = [&](auto &&fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < oiters; ++i) fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / oiters;
+  };
+  for (int simd = 0; simd < 2; ++simd) {
+    const char *tag = simd ? "simd" : "scalar";
+    double ms = time_ms([&] {
+      (simd ? blend_color_32 : blend_color_32_scalar)(frame.data(), fw * 4, fw, fh, 0, 128, nullptr, 0);
+    });
+    std::printf("dim32   %-6s %6.3f ms\n", tag, ms);
+    ms = time_ms([&] {
+      (simd ? blend_color_32 : blend_color_32_scalar)(frame.data(), fw * 4, fw, fh, 0x336699, 160, glow_mask.data(), fw);
+    });
+    std::printf("glow32  %-6s %6.3f ms\n", tag, ms);
+    ms = time_ms([&] {
+      (simd ? blend_color_565 : blend_color_565_scalar)(frame.data(), fw * 2, fw, fh, 0, 128, nullptr, 0);
+    });
+    std::printf("dim565  %-6s %6.3f ms\n", tag, ms);
+    ms = time_ms([&] {
+      (simd ? blend_argb_32 : blend_argb_32_scalar)(sprite.data(), fw * 4, frame.data(), fw * 4, fw, fh);
+    });
+    std::printf("argb32  %-6s %6.3f ms\n", tag, ms);
+  }
+  return 0;
+}
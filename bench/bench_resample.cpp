@@ -0,0 +1,65 @@
+// bench/bench_resample.cpp
+//
+// Compares the resampling filters of decode_to_texture against the previous
+// nearest-neighbour path (integer divide per pixel) on a synthetic 1080p source.
+// Run with `make bench`; prints ms per resample for each cover size.
+
+#include "core/image_loader.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using core::ResampleFilter;
+using core::resample_rgb_to_rgb565;
+
+// Previous implementation, kept here as the baseline.
+static std::vector<uint16_t> legacy_nearest(const unsigned char *src, int src_w, int src_h, int tgt_w, int tgt_h) {
+  std::vector<uint16_t> out(static_cast<size_t>(tgt_w) * static_cast<size_t>(tgt_h));
+  for (int y = 0; y < tgt_h; ++y) {
+    int sy = (y * src_h) / tgt_h;
+    for (int x = 0; x < tgt_w; ++x) {
+      int sx = (x * src_w) / tgt_w;
+      const unsigned char *p = src + (static_cast<size_t>(sy) * src_w + sx) * 3;
+      out[static_cast<size_t>(y) * tgt_w + x] =
+          static_cast<uint16_t>(((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3));
+    }
+  }
+  return out;
+}
+
+template <typename F>
+static double time_ms(int iters, F &&fn) {
+  auto t0 = std::chrono::steady_clock::now();
+  volatile size_t sink = 0;
+  for (int i = 0; i < iters; ++i) sink = sink + fn().size();
+  auto t1 = std::chrono::steady_clock::now();
+  (void)sink;
+  return std::chrono::duration<double, std::milli>(t1 - t0).count() / iters;
+}
+
+int main() {
+  const int src_w = 1920, src_h = 1080;
+  std::vector<unsigned char> src(static_cast<size_t>(src_w) * src_h * 3);
+  uint32_t seed = 12345;
+  for (auto &b : src) {
+    seed = seed * 1664525u + 1013904223u;
+    b = static_cast<unsigned char>(seed >> 24);
+  }
+
+  struct Size { int w, h; } sizes[] = {{250, 250}, {640, 480}, {2560, 1440}};
+  const int iters = 10;
+  std::printf("%-12s %10s %10s %10s %10s %10s\n", "target", "legacy", "nearest", "area", "bilinear", "auto");
+  for (const auto &s : sizes) {
+    double legacy = time_ms(iters, [&] { return legacy_nearest(src.data(), src_w, src_h, s.w, s.h); });
+    double nearest = time_ms(iters, [&] { return resample_rgb_to_rgb565(src.data(), src_w, src_h, s.w, s.h, ResampleFilter::NEAREST); });
+    double area = time_ms(iters, [&] { return resample_rgb_to_rgb565(src.data(), src_w, src_h, s.w, s.h, ResampleFilter::AREA); });
+    double bilinear = time_ms(iters, [&] { return resample_rgb_to_rgb565(src.data(), src_w, src_h, s.w, s.h, ResampleFilter::BILINEAR); });
+    double autof = time_ms(iters, [&] { return resample_rgb_to_rgb565(src.data(), src_w, src_h, s.w, s.h); });
+    char label[32];
+    std::snprintf(label, sizeof(label), "%dx%d", s.w, s.h);
+    std::printf("%-12s %8.2fms %8.2fms %8.2fms %8.2fms %8.2fms\n", label, legacy, nearest, area, bilinear, autof);
+  }
+  return 0;
+}
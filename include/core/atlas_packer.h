@@ -0,0 +1,83 @@
+#pragma once
+#ifndef SLIDERUI_CORE_ATLAS_PACKER_H
+#define SLIDERUI_CORE_ATLAS_PACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+
+struct AtlasRect {
+  int x = 0, y = 0, w = 0, h = 0;
+};
+
+/**
+ * AtlasPacker - region allocator for a long-lived sprite atlas (no pixels, just layout).
+ *
+ * Usage per frame:
+ *   packer.begin_frame();
+ *   AtlasRect r;
+ *   if (!packer.find(id, r) && packer.insert(id, w, h, r)) upload(id, r);
+ *   draw_from_atlas(r);
+ *
+ * Notes:
+ * - New regions go on a skyline (bottom-left: lowest top edge, then leftmost).
+ * - When the skyline is full, entries not used since the previous begin_frame() are
+ *   evicted least recently used first; their regions are reused for items that fit
+ *   (best fit by area). Entries used in the current frame are never evicted, so a frame
+ *   only ever touches already-packed regions.
+ * - Once everything is evicted the skyline is reset, which undoes fragmentation.
+ * - insert() returns false when the item can't be placed; draw it without the atlas.
+ */
+class AtlasPacker {
+public:
+  AtlasPacker(int width = 0, int height = 0);
+
+  // Drop every entry and start over with a width x height atlas
+  void reset(int width, int height);
+
+  // Start a new frame: entries used from now on are pinned until the next call
+  void begin_frame();
+
+  // Region of `id` if it is packed (marks it used in this frame)
+  bool find(const std::string &id, AtlasRect &out);
+
+  // Pack a w x h region for `id` (or return the existing one); see class notes
+  bool insert(const std::string &id, int w, int h, AtlasRect &out);
+
+  void evict(const std::string &id);
+
+  int width() const { return width_; }
+  int height() const { return height_; }
+  size_t size() const { return entries_.size(); }
+  size_t evictions() const { return evictions_; }
+
+private:
+  struct Node {
+    int x, y, w; // skyline segment: [x, x + w) is filled up to y
+  };
+  struct Entry {
+    AtlasRect rect; // region handed out
+    AtlasRect slot; // region reserved (>= rect when reusing a larger free slot)
+    uint64_t last_used = 0;
+  };
+
+  bool place_skyline(int w, int h, AtlasRect &out);
+  bool place_free(int w, int h, AtlasRect &slot);
+  bool evict_lru();
+
+  int width_ = 0;
+  int height_ = 0;
+  uint64_t frame_ = 1;
+  size_t evictions_ = 0;
+  std::vector<Node> skyline_;
+  std::vector<AtlasRect> free_;
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+} // namespace core
+
+#endif // SLIDERUI_CORE_ATLAS_PACKER_H
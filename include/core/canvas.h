@@ -0,0 +1,124 @@
+#pragma once
+#ifndef SLIDERUI_CORE_CANVAS_H
+#define SLIDERUI_CORE_CANVAS_H
+
+#include "core/image_loader.h"
+#include "core/pixel_convert.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace core {
+
+/**
+ * Canvas - in-memory frame buffer for rendering without a display (headless renderer,
+ * golden images, benchmarks).
+ *
+ * Layout matches the SDL screens the renderer runs on:
+ * - 16 bpp: RGB565
+ * - 32 bpp: XRGB8888, one native-endian 0xXXRRGGBB word per pixel (the X byte is unused;
+ *   fills write 0, blends may leave it set, as on the SDL screen)
+ * Drawing goes through the same pixel_convert kernels as the SDL backend (scale_blit_*,
+ * blend_color_*, blend_argb_*, downsample_2x_*), so both produce the same pixels.
+ *
+ * Every draw call is clipped to clip() (the whole canvas after reset()).
+ */
+class Canvas {
+public:
+  Canvas() = default;
+  Canvas(int width, int height, int bpp);
+
+  // Resize to width x height at 16 or 32 bpp (anything else means 32); pixels become 0
+  void reset(int width, int height, int bpp);
+
+  int width() const { return w_; }
+  int height() const { return h_; }
+  int bpp() const { return bpp_; }
+  int bytes_per_pixel() const { return bpp_ / 8; }
+  int pitch() const { return pitch_; }
+  bool empty() const { return pixels_.empty(); }
+  uint8_t *data() { return pixels_.data(); }
+  const uint8_t *data() const { return pixels_.data(); }
+
+  void set_clip(const BlitRect &clip);
+  const BlitRect &clip() const { return clip_; }
+
+  // Pixel value of (r, g, b) in this canvas' layout, and back (565 expands by bit replication)
+  uint32_t map_rgb(uint8_t r, uint8_t g, uint8_t b) const;
+  void get_rgb(int x, int y, uint8_t &r, uint8_t &g, uint8_t &b) const;
+
+  void fill_rect(int x, int y, int w, int h, uint8_t r, uint8_t g, uint8_t b);
+
+  // Blend (r, g, b) at alpha `a`; `mask` (optional) is per-pixel coverage of the unclipped
+  // w x h rect, scaled by `a` (see blend_color_32)
+  void blend_rect(int x, int y, int w, int h, uint8_t r, uint8_t g, uint8_t b, uint8_t a,
+                  const uint8_t *mask = nullptr, int mask_pitch = 0);
+
+  // Copy `from` of src (same bpp) to (x, y); false if the formats differ
+  bool blit(const Canvas &src, const BlitRect &from, int x, int y);
+  bool blit(const Canvas &src, int x, int y) { return blit(src, BlitRect{0, 0, src.w_, src.h_}, x, y); }
+
+  // Scale all of src (same bpp) into `to`; false if the formats differ
+  bool blit_scaled(const Canvas &src, const BlitRect &to, BlitFilter filter = BlitFilter::BILINEAR);
+
+  // Alpha-blend a w x h ARGB8888 sprite (0xAARRGGBB words) at (x, y)
+  void blend_argb(const uint32_t *argb, int src_pitch, int w, int h, int x, int y);
+
+  // Replace the contents with a decoded image (RGB or RGBA bytes). RGBA is flattened onto
+  // `matte` (0xRRGGBB); at 16 bpp rows go through rgb888_to_rgb565_row with `dither`.
+  bool load_image(const uint8_t *pixels, int width, int height, int channels, bool dither = true,
+                  uint32_t matte = 0);
+
+  // Decode an image file into a w x h canvas (fitted with `mode`) through load_image; false
+  // (contents untouched) when it can't be read or decoded
+  bool load_file(const std::string &path, int w, int h, ScaleMode mode, bool dither = true);
+
+  // Half-size copy (downsample_2x_32/565), as used for cover mip levels
+  Canvas downsample_2x() const;
+
+  // Binary PPM (P6) of the whole canvas
+  bool write_ppm(const std::string &path) const;
+
+private:
+  int w_ = 0;
+  int h_ = 0;
+  int bpp_ = 32;
+  int pitch_ = 0;
+  BlitRect clip_{0, 0, 0, 0};
+  std::vector<uint8_t> pixels_;
+};
+
+// "#RRGGBB" or "#RRGGBBAA" (alpha defaults to 255); false leaves the outputs untouched
+bool parse_hex_color(const std::string &s, uint8_t &r, uint8_t &g, uint8_t &b, uint8_t &a);
+
+/**
+ * A rounded rect sprite: `stroke` px of border, then fill (nothing when hollow), with an
+ * optional 1px highlight row just inside the top border. Used for the selector pill and
+ * the selected_contour outline by every renderer backend.
+ */
+struct ShapeStyle {
+  int radius = 0;
+  int stroke = 1;
+  uint8_t border[3] = {0, 0, 0};
+  bool hollow = false;
+  uint8_t fill[3] = {0, 0, 0};
+  bool highlight = false;
+  uint8_t hi[3] = {0, 0, 0};
+};
+
+// Cache key covering the size and every ShapeStyle field
+std::string shape_key(int w, int h, const ShapeStyle &st);
+
+// w x h ARGB8888 pixels (0xAARRGGBB, straight alpha) of `st`; edges are antialiased from
+// the signed distance to the outline (one pixel across)
+std::vector<uint32_t> render_shape(int w, int h, const ShapeStyle &st);
+
+// Glow coverage around a w x h rect, `spread` px on every side ((w + 2 spread) x
+// (h + 2 spread) bytes): quadratic falloff with the distance from the rect, 0 inside it
+std::vector<uint8_t> glow_mask(int w, int h, int spread);
+
+} // namespace core
+
+#endif // SLIDERUI_CORE_CANVAS_H
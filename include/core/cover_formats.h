@@ -0,0 +1,44 @@
+#pragma once
+#ifndef SLIDERUI_CORE_COVER_FORMATS_H
+#define SLIDERUI_CORE_COVER_FORMATS_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace core {
+
+/**
+ * Pre-baked cover formats: cheap to decode on the device, produced on the host by
+ * tools/cover_convert.
+ *
+ * QOI ("Quite OK Image", qoiformat.org): lossless, single pass, no entropy coding.
+ *   14-byte header "qoif" | width BE32 | height BE32 | channels (3/4) | colorspace,
+ *   then the op stream, then 7 x 0x00 + 0x01.
+ *
+ * Raw RGB565 (".r565"): pixels ready for a 16bpp framebuffer.
+ *   16-byte header "R565" | version LE32 (1) | width LE32 | height LE32,
+ *   then width*height little-endian RGB565 pixels, row-major, no padding.
+ */
+constexpr size_t kQoiHeaderSize = 14;
+constexpr size_t kRgb565HeaderSize = 16;
+constexpr uint32_t kRgb565Version = 1;
+
+struct CoverHeader {
+  uint32_t width = 0;
+  uint32_t height = 0;
+  int channels = 0; // QOI: 3 or 4; RGB565: 3
+};
+
+// Parse and validate a header. False if the magic, version or sizes don't match
+// (RGB565: the pixel payload must be present in full).
+bool parse_qoi_header(const unsigned char *data, size_t size, CoverHeader &out);
+bool parse_rgb565_header(const unsigned char *data, size_t size, CoverHeader &out);
+
+// Encoders (host tools/tests). `px` is row-major with `channels` (3 or 4) bytes per pixel.
+std::vector<unsigned char> encode_qoi(const unsigned char *px, int w, int h, int channels);
+std::vector<unsigned char> encode_rgb565_raw(const uint16_t *px, int w, int h);
+
+} // namespace core
+
+#endif // SLIDERUI_CORE_COVER_FORMATS_H
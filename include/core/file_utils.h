@@ -4,6 +4,8 @@
 
 #include <string>
 #include <cstdint>
+#include <cstddef>
+#include <vector>
 
 namespace file_utils {
 
@@ -31,6 +33,44 @@ uint64_t file_mtime(const std::string &path);
  */
 std::string get_exe_dir();
 
+/**
+ * MappedFile - read-only view of a whole file for decoders (no copy, no iostreams).
+ *
+ * - Files of at least kMapThreshold bytes are mmap'ed read-only with MADV_SEQUENTIAL
+ *   (aggressive readahead); smaller files are read with a single pread into an owned buffer,
+ *   where a mapping would cost more than the copy.
+ * - done_reading() tells the kernel the pages can go (MADV_DONTNEED); close() and the
+ *   destructor do the same and unmap.
+ * - data()/size() stay valid until close()/destruction. Movable, not copyable.
+ */
+class MappedFile {
+public:
+    static constexpr size_t kMapThreshold = 64 * 1024;
+
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    // Open and map/read `path`. Returns false (and stays empty) on error or for empty files.
+    bool open(const std::string &path);
+    void close();
+    void done_reading();
+
+    const unsigned char *data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool is_mapped() const { return mapped_; }
+
+private:
+    const unsigned char *data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<unsigned char> buf_; // small-file fallback
+};
+
 } // namespace file_utils
 
 #endif // SLIDERUI_CORE_FILE_UTILS_H
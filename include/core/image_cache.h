@@ -1,8 +1,15 @@
 // include/core/image_cache.h
 #pragma once
 
+#include "core/image_loader.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <mutex>
 #include <vector>
 
@@ -14,16 +21,31 @@ struct ImageData {
     int height = 0;
     int channels = 0; // 3 => RGB, 4 => RGBA
     std::vector<unsigned char> pixels; // decoded pixels, row-major
+    ImageFormat format = ImageFormat::UNKNOWN; // sniffed format of the source file
+    // RGB565 sources decoded at their own size: the file's pixels, width x height
+    std::vector<uint16_t> rgb565;
 };
 
+// Write `data` as RGB565 rows `pitch` bytes apart, as 16-bit surfaces hold it. The kept
+// payload of an RGB565 source is copied as is; other RGB565-sourced pixels are converted
+// without dithering (they already sit on the 565 grid). RGBA is flattened onto `matte`
+// (0xRRGGBB). False for an unsupported channel count.
+bool image_to_rgb565(const ImageData &data, uint8_t *dst, int pitch, bool dither, uint32_t matte = 0);
+
 class ImageCache {
 public:
     ImageCache();
     ~ImageCache();
 
-    // ensure image is decoded and cached (returns true on success)
+    // ensure image is decoded and cached (returns true on success).
+    // The cache lock is not held while decoding, so preloads of different paths from
+    // several threads run in parallel; a second preload of a path being decoded waits for it.
     bool preload(const std::string &path);
 
+    // preload() a batch on ThreadPool::shared(), at most max_threads at once
+    // (0 => decode_concurrency()). Returns how many are cached afterwards.
+    size_t preload_many(const std::vector<std::string> &paths, unsigned max_threads = 0);
+
     bool has(const std::string &path) const;
     ImageData get(const std::string &path) const;
 
@@ -35,19 +57,81 @@ public:
     // Default is false (RGB only).
     void set_prefer_rgba(bool v);
 
+    // Pixel format of the surfaces handed out (platform.color_depth): 32 => RGBA8888
+    // (default), 16 => RGB565 matching a 16-bit screen, so blits are plain copies. 16-bit
+    // surfaces have no alpha (RGBA is flattened onto the letterbox color) and are
+    // ordered-dithered unless `dither` is false. Call before the first get_*surface().
+    void set_surface_depth(int bpp, bool dither = true);
+
+    // Smallest size images are displayed at (e.g. ui.game_image width/height). When set and
+    // built with HAVE_LIBJPEG, JPEGs are decoded at a reduced DCT scale that still covers it
+    // instead of at full resolution. 0 x 0 (default) disables the reduction.
+    void set_decode_size_hint(int min_w, int min_h);
+
+    // Slot sizes the UI blits covers at (e.g. the active and side_scale carousel sizes).
+    // preload() then also produces a w x h copy of each image fitted per `mode`
+    // (ui.game_image.scale; FIT letterboxes with letterbox_rgb, 0xRRGGBB), so drawing is a
+    // 1:1 blit. Call before preloading; already cached images are scaled on first use.
+    void set_display_sizes(const std::vector<std::pair<int, int>> &sizes, ScaleMode mode,
+                           uint32_t letterbox_rgb = 0);
+
+    // Native surface (SDL_Surface*) of `path` fitted to exactly w x h per set_display_sizes'
+    // mode, or nullptr. Owned by ImageCache.
+    void *get_scaled_surface(const std::string &path, int w, int h);
+
+    // The fitted w x h pixels get_scaled_surface() converts, available without SDL (e.g. for
+    // the headless renderer, which keeps its own converted copy). Empty if undecodable.
+    ImageData get_scaled_image(const std::string &path, int w, int h);
+
+    // letterbox_rgb of set_display_sizes (0xRRGGBB): FIT borders, and the matte RGBA is
+    // flattened onto for 16-bit surfaces
+    uint32_t letterbox_rgb() const;
+
+    // Box-filtered mip chain of the w x h fitted cover: level 0 is get_scaled_surface(path, w, h),
+    // level k is (w >> k) x (h >> k), made with downsample_2x_32/_565 on first use and kept until
+    // clear(). Surfaces are owned by ImageCache; count == 0 if the cover is unavailable.
+    static constexpr int kMipLevels = 3;
+    struct MipChain {
+        void *levels[kMipLevels] = {};
+        int count = 0;
+    };
+    MipChain get_mip_chain(const std::string &path, int w, int h);
+
+    // Level of that chain to scale from for a draw at dst_w x dst_h: the nearest level that
+    // is not smaller than the destination (see mip_level_for). nullptr if unavailable.
+    void *get_mip_for_size(const std::string &path, int w, int h, int dst_w, int dst_h);
+
     // remove cached decoded images and surfaces
     void clear();
 
 private:
-    bool decode_image_to_memory(const std::string &path, ImageData &out);
+    // runs without mtx_; settings are snapshotted by the caller
+    bool decode_image_to_memory(const std::string &path, int wanted, int hint_w, int hint_h,
+                                ScaleMode scale, ImageData &out);
+    static bool scale_image(const ImageData &src, int w, int h, ScaleMode mode, uint32_t letterbox_rgb,
+                            ImageData &out);
+    static std::string scaled_key(const std::string &path, int w, int h);
 
     mutable std::mutex mtx_;
     std::unordered_map<std::string, ImageData> cache_;
+    std::unordered_set<std::string> inflight_; // paths being decoded by preload()
+    std::condition_variable inflight_cv_;
 
     // store native surfaces as void* to avoid SDL headers in the public header
     std::unordered_map<std::string, void*> surface_cache_;
+    // fitted copies waiting for get_scaled_surface (key: scaled_key)
+    std::unordered_map<std::string, ImageData> scaled_;
+    // mip chains by scaled_key; levels >= 1 are owned here, level 0 by surface_cache_
+    std::unordered_map<std::string, MipChain> mips_;
 
     bool prefer_rgba_;
+    int surface_bpp_ = 32;
+    bool dither565_ = true;
+    int hint_w_ = 0;
+    int hint_h_ = 0;
+    std::vector<std::pair<int, int>> display_sizes_;
+    ScaleMode scale_mode_ = ScaleMode::STRETCH;
+    uint32_t letterbox_rgb_ = 0;
 };
 
 } // namespace core
@@ -4,11 +4,15 @@
 
 #include <string>
 #include <vector>
+#include <cstddef>
 #include <optional>
 #include <cstdint>
+#include <memory>
 
 namespace core {
 
+class ConfigManager;
+
 /**
  * Texture - decoded image in RGB565 format
  * width, height: dimensions in pixels
@@ -21,18 +25,247 @@ struct Texture {
   std::vector<uint16_t> pixels; // size = width * height
 };
 
+/**
+ * Resampling filter used when the decoded size differs from the target size.
+ * - NEAREST:  point sampling (fastest, aliases when downscaling)
+ * - AREA:     box/area averaging (best for downscaling)
+ * - BILINEAR: 2-tap linear interpolation (best for upscaling)
+ * - AUTO:     AREA on axes that shrink, BILINEAR on axes that grow (default)
+ */
+enum class ResampleFilter { AUTO, NEAREST, AREA, BILINEAR };
+
+/**
+ * How an image is fitted into a fixed-size box (ui.game_image.scale).
+ * - STRETCH: resample to the box size, ignoring the aspect ratio
+ * - FIT:     whole image, aspect kept, centered; the rest of the box is letterbox
+ * - FILL:    aspect kept, covers the box; the overflow is center-cropped
+ */
+enum class ScaleMode { STRETCH, FIT, FILL };
+
+/** "fit" / "fill" / "stretch" (case-insensitive); anything else gives `fallback`. */
+ScaleMode scale_mode_from_string(const std::string &name, ScaleMode fallback = ScaleMode::FIT);
+
+/**
+ * ScalePlan - which source rectangle lands where in a box_w x box_h output.
+ * Sizes are at least 1 pixel; the dst rect is centered in the box.
+ */
+struct ScalePlan {
+  int crop_x = 0, crop_y = 0, crop_w = 0, crop_h = 0; // source pixels used
+  int dst_x = 0, dst_y = 0, dst_w = 0, dst_h = 0;     // where they go in the box
+};
+
+ScalePlan plan_scale(int src_w, int src_h, int box_w, int box_h, ScaleMode mode);
+
+/**
+ * Mip level to sample when drawing a base_w x base_h image at dst_w x dst_h: the smallest
+ * of `levels` levels (0 = full size, k = base >> k, as made by downsample_2x_32) that is
+ * still >= the destination on both axes, so scaling never magnifies a reduced level.
+ */
+int mip_level_for(int base_w, int base_h, int dst_w, int dst_h, int levels);
+
+/**
+ * Resample tightly packed 8-bit RGB (src_w*src_h*3) to tgt_w x tgt_h RGB565.
+ * Fixed-point separable passes with per-column/per-row weights computed once per call;
+ * no per-pixel divisions. Returns an empty vector on invalid sizes.
+ * The final RGB565 pack goes through rgb888_to_rgb565_row (SIMD); `dither` enables its
+ * 4x4 ordered dithering, worth it for gradients such as background art.
+ */
+std::vector<uint16_t> resample_rgb_to_rgb565(const unsigned char *src_rgb, int src_w, int src_h,
+                                             int tgt_w, int tgt_h,
+                                             ResampleFilter filter = ResampleFilter::AUTO,
+                                             bool dither = false);
+
+/** resample_rgb_to_rgb565 with RGB888 output (e.g. for host-side asset baking). */
+std::vector<unsigned char> resample_rgb(const unsigned char *src_rgb, int src_w, int src_h,
+                                        int tgt_w, int tgt_h,
+                                        ResampleFilter filter = ResampleFilter::AUTO);
+
+/**
+ * Fit/fill `src_rgb` into a box_w x box_h RGB888 image per `mode` (see plan_scale);
+ * letterbox pixels get `fill_rgb` (0xRRGGBB).
+ */
+std::vector<unsigned char> resample_rgb_scaled(const unsigned char *src_rgb, int src_w, int src_h,
+                                               int box_w, int box_h, ScaleMode mode,
+                                               uint32_t fill_rgb = 0,
+                                               ResampleFilter filter = ResampleFilter::AUTO);
+
+/**
+ * RowResampler - streaming form of resample_rgb_to_rgb565.
+ *
+ * Source rows are pushed top to bottom as a decoder produces them; each output row is
+ * filtered and packed into `dst` (tgt_w * tgt_h RGB565, caller owned) as soon as its last
+ * source row has arrived. Only ~filter-height horizontally filtered rows are kept, so peak
+ * memory is O(tgt_w * taps) instead of a full decoded image. Output is identical to
+ * resample_rgb_to_rgb565 for the same arguments.
+ */
+class RowResampler {
+public:
+  RowResampler(int src_w, int src_h, int tgt_w, int tgt_h, uint16_t *dst,
+               ResampleFilter filter = ResampleFilter::AUTO, bool dither = false);
+  // Same filtering, RGB888 output (tgt_w * tgt_h * 3 bytes, caller owned)
+  RowResampler(int src_w, int src_h, int tgt_w, int tgt_h, unsigned char *dst_rgb,
+               ResampleFilter filter = ResampleFilter::AUTO);
+  // Resample plan.crop of a src_w x src_h image into plan.dst of a box_w pixels wide
+  // output; rows outside the crop are skipped, pixels outside plan.dst are not written.
+  RowResampler(const ScalePlan &plan, int src_w, int src_h, int box_w, uint16_t *dst,
+               ResampleFilter filter = ResampleFilter::AUTO, bool dither = false);
+  RowResampler(const ScalePlan &plan, int src_w, int src_h, int box_w, unsigned char *dst_rgb,
+               ResampleFilter filter = ResampleFilter::AUTO);
+  ~RowResampler();
+
+  // Next source row: src_w tightly packed RGB888 pixels. Extra rows are ignored.
+  void push_row(const unsigned char *rgb);
+
+  // True once all src_h rows were pushed (dst fully written).
+  bool done() const;
+
+private:
+  RowResampler(const RowResampler&) = delete;
+  RowResampler& operator=(const RowResampler&) = delete;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/**
+ * Pick the libjpeg DCT scale denominator (8, 4, 2 or 1) that gives the smallest decoded
+ * size still >= min_w x min_h (ceil(src / denom) on each axis). Returns 1 when no
+ * reduction is possible or a size is <= 0.
+ */
+int jpeg_scale_denom(int src_w, int src_h, int min_w, int min_h);
+
+/**
+ * Decode a JPEG held in memory to tightly packed RGB at reduced resolution, using DCT-domain
+ * scaling (jpeg_scale_denom) so that the result is still >= min_w x min_h.
+ * Pass min_w/min_h <= 0 to decode at full size; a `denom` of 1, 2, 4 or 8 (e.g. from
+ * plan_decode_scale) overrides the min_w/min_h based choice.
+ * Only available when built with HAVE_LIBJPEG; otherwise (or on any decode error) returns false.
+ */
+bool decode_jpeg_scaled(const unsigned char *data, size_t size, int min_w, int min_h,
+                        std::vector<unsigned char> &out_rgb, int &out_w, int &out_h, int denom = 0);
+
+/** True if the buffer starts with the JPEG SOI marker (FF D8 FF). */
+bool is_jpeg_data(const unsigned char *data, size_t size);
+
+// QOI and RGB565 are the pre-baked cover formats described in core/cover_formats.h
+enum class ImageFormat { UNKNOWN, PNG, JPEG, BMP, GIF, WEBP, QOI, RGB565, OTHER };
+
+/**
+ * ImageInfo - what a header probe reveals without decoding any pixels.
+ */
+struct ImageInfo {
+  int width = 0;
+  int height = 0;
+  int channels = 0; // channels stored in the file (stb_image convention)
+  ImageFormat format = ImageFormat::UNKNOWN;
+};
+
+/** Short lowercase name ("png", "jpg", "webp", ...) as used by platform.image_formats. */
+const char *image_format_name(ImageFormat fmt);
+
+/**
+ * Probe dimensions/format of an encoded image in memory (stbi_info_from_memory, or
+ * WebPGetInfo with HAVE_WEBP). No pixel data is decoded. std::nullopt if not recognized.
+ */
+std::optional<ImageInfo> probe_image_memory(const unsigned char *data, size_t size);
+
+/** Probe an image file, reading only its first 64 KiB (whole file via stb for late JPEG SOFs). */
+std::optional<ImageInfo> probe_image(const std::string &path);
+
+/**
+ * Process-wide decode limit (platform.image_max_dimensions). 0 disables an axis.
+ * Larger images are resampled down while decoding. Streaming backends (libjpeg, libpng,
+ * QOI, RGB565) take any size; backends that decode the whole image first (stb_image,
+ * libwebp, interlaced PNG, RGBA output) refuse images over 4x the limit per axis.
+ */
+void set_image_max_dimensions(int max_w, int max_h);
+
+/**
+ * Decoder registry filter (platform.image_formats): names as returned by image_format_name,
+ * "jpeg" is accepted for "jpg". An empty list enables every format (the default).
+ */
+void set_enabled_image_formats(const std::vector<std::string> &names);
+bool image_format_enabled(ImageFormat fmt);
+
+/** Apply platform.image_max_dimensions, image_formats and decode_threads from the config. */
+void configure_image_decoding(const ConfigManager &cfg);
+
+/**
+ * Name of the backend the registry tries first for `fmt` ("libjpeg", "libpng", "libwebp",
+ * "stb"), or nullptr when the format is disabled or unsupported. `alpha` asks for a backend
+ * that can produce RGBA.
+ */
+const char *image_decoder_name(ImageFormat fmt, bool alpha = false);
+
+/**
+ * Decide how to decode a probed image that will be shown at >= min_w x min_h:
+ * returns the JPEG DCT denominator (1, 2, 4, 8; always 1 for other formats) whose output
+ * fits the limits, preferring the smallest output still covering min_w x min_h.
+ * Returns 0 when the decoded image cannot be brought under the limits, i.e. it has to
+ * be resampled down after (or while) decoding.
+ */
+int plan_decode_scale(const ImageInfo &info, int min_w = 0, int min_h = 0);
+
+/**
+ * Decode an encoded image in memory to 8-bit RGB (channels == 3) or RGBA (4), row-major.
+ * The format is sniffed from magic bytes and dispatched through the decoder registry;
+ * probing, platform.image_formats and image_max_dimensions apply as for decode_to_texture.
+ * RGB output over the limit comes back resampled to the largest size within it (aspect
+ * kept), so out_w/out_h may be smaller than the file's; RGBA is kept at decoded size.
+ * min_w/min_h (the display size, 0 = unknown) let scaling backends decode smaller; with
+ * FIT/FILL `scale` they are the display box and the kept size covers the fitted image.
+ * `label` (e.g. the path) is only used in log messages. Returns false on any failure.
+ */
+bool decode_image_memory(const unsigned char *data, size_t size, int channels, int min_w, int min_h,
+                         std::vector<unsigned char> &out, int &out_w, int &out_h,
+                         const std::string &label = std::string(),
+                         ScaleMode scale = ScaleMode::STRETCH);
+
 /**
  * Decode image at `path` and convert/rescale to target_w x target_h.
- * Allowed source formats depend on stb_image compiled formats (PNG, JPG, BMP...).
+ * The format is sniffed from the file's magic bytes (the extension is ignored) and decoded
+ * by the fastest registered backend: libjpeg/libpng/libwebp when compiled in, stb_image
+ * (PNG, JPG, BMP, GIF, ...) otherwise; QOI and raw RGB565 use built-in decoders.
+ * A raw RGB565 file that already has the target size is copied straight into the texture.
  *
- * - If path ends with .webp and HAVE_WEBP is **not** defined at compile time,
- *   function returns std::nullopt (caller must handle).
+ * - WebP without HAVE_WEBP, or a format missing from platform.image_formats, returns
+ *   std::nullopt (caller must handle).
  * - Returns std::optional<Texture> with rgb565 pixels on success, std::nullopt on failure.
+ * - `dither` applies 4x4 ordered dithering during the RGB565 conversion.
+ * - `scale` keeps the aspect ratio (FIT letterboxes in black, FILL center-crops) so the
+ *   texture can be blitted 1:1 into a target_w x target_h slot.
+ * - The header is probed first; images beyond image_max_dimensions are only rejected
+ *   (std::nullopt, before pixels are allocated) when no streaming backend (below) can
+ *   take them and they exceed 4x the limit; otherwise they are downscaled as usual.
+ * - With HAVE_LIBJPEG, JPEGs are decoded at the smallest 1/2, 1/4 or 1/8 scale that is
+ *   still >= the target size, then resampled.
+ * - JPEG (HAVE_LIBJPEG) and non-interlaced PNG (HAVE_LIBPNG) are streamed: decoded strips
+ *   go straight through a RowResampler, so no full-size RGB image is allocated. Other
+ *   inputs are decoded whole by stb_image.
  *
  * Note: implementation uses stb_image.h. No dynamic allocation policy applies only
  * to runtime rendering loop; this helper can allocate.
  */
-std::optional<Texture> decode_to_texture(const std::string &path, int target_w, int target_h);
+std::optional<Texture> decode_to_texture(const std::string &path, int target_w, int target_h,
+                                         ResampleFilter filter = ResampleFilter::AUTO,
+                                         bool dither = false,
+                                         ScaleMode scale = ScaleMode::STRETCH);
+
+/**
+ * Decode a batch of images in parallel on ThreadPool::shared().
+ * Returns one entry per path, in order (nullopt where decode_to_texture would fail).
+ * max_threads caps how many decodes run at once, the calling thread included;
+ * 0 uses decode_concurrency().
+ */
+std::vector<std::optional<Texture>> decode_many(const std::vector<std::string> &paths, int target_w,
+                                                int target_h,
+                                                ResampleFilter filter = ResampleFilter::AUTO,
+                                                bool dither = false, unsigned max_threads = 0,
+                                                ScaleMode scale = ScaleMode::STRETCH);
+
+/** Default decode_many/ImageCache::preload_many concurrency; 0 => one per core. */
+void set_decode_concurrency(unsigned threads);
+unsigned decode_concurrency();
 
 } // namespace core
 
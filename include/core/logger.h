@@ -4,9 +4,33 @@
 
 #include <string>
 #include <memory>
+#include <atomic>
+#include <cstdint>
+
+// Compile-time floor for the LOG_* macros (0=TRACE, 1=DEBUG, 2=INFO, 3=ERROR, 4=OFF).
+// Statements below this level compile to nothing; e.g. build with -DSLIDERUI_LOG_MIN_LEVEL=2.
+#ifndef SLIDERUI_LOG_MIN_LEVEL
+#define SLIDERUI_LOG_MIN_LEVEL 0
+#endif
 
 namespace core {
 
+class ConfigManager;
+
+enum class LogLevel : int { TRACE = 0, DEBUG = 1, INFO = 2, ERROR = 3, OFF = 4 };
+
+// Subsystem bits for per-subsystem enable masks (config: logging.subsystems.<name>: bool).
+enum class LogSubsystem : uint32_t {
+  CORE   = 1u << 0,  // "core"
+  CONFIG = 1u << 1,  // "config"
+  IMAGE  = 1u << 2,  // "image"
+  RENDER = 1u << 3,  // "render"
+  INPUT  = 1u << 4,  // "input"
+  MENU   = 1u << 5,  // "menu"
+  SLIDER = 1u << 6,  // "slider"
+  ALL    = 0xFFFFFFFFu
+};
+
 /**
  * Logger - simple singleton logger with rotation.
  *
@@ -17,17 +41,68 @@ namespace core {
  *
  * Notes:
  * - init() should be called once early; calling again will reinitialize.
- * - info()/error() buffer entries in memory; buffer flushes to disk only when rotation triggers.
- * - On rotation the logger writes buffered data to 'log.0' and shifts older files to log.1...log.N-1.
+ * - info()/error() format the line into a slot of a fixed-size lock-free ring and return;
+ *   they never lock, allocate inside the logger or touch the filesystem. When the ring is
+ *   full the record is dropped and counted (a "[LOGGER] dropped N" line is written later).
+ * - A background flusher thread appends pending records to 'log.0' with writev straight from
+ *   the ring, once buffer_threshold bytes are pending, the ring is half full, or a second has
+ *   passed. log.0 is opened with O_APPEND and kept open between flushes.
+ * - When log.0 would grow past max_file_bytes it is rotated: older files shift to
+ *   log.1...log.N-1 (the oldest is dropped) and a fresh log.0 is started.
+ * - Records longer than the ring slot are truncated.
+ * - Crash-safe mode (init_ring / logging.ring): lines are memcpy'd straight into a fixed-size
+ *   mmapped ring file <dir>/ring.bin, so a crash or power loss keeps the newest records (the
+ *   oldest are overwritten instead of dropped). On the next init_ring() and on clean shutdown
+ *   the ring is converted into the log.N text files; decode_ring() does the same offline.
+ * - Prefer the LOG_TRACE/LOG_DEBUG/LOG_INFO/LOG_ERROR macros: the message expression is only
+ *   evaluated when the level passes both the compile-time floor (SLIDERUI_LOG_MIN_LEVEL) and
+ *   the runtime level/subsystem mask, e.g.
+ *     LOG_TRACE(RENDER, "[minui selector] x=" + std::to_string(x));
+ * - Nothing is logged until init()/init_from_config() succeeds.
  */
 class Logger {
 public:
   // Get singleton
   static Logger& instance();
 
-  // Initialize logger: directory, max files to keep, optional buffer threshold bytes to trigger rotation.
+  // Initialize logger: directory, max files to keep, pending bytes that trigger an early write,
+  // and the size at which log.0 is rotated.
   // Returns true on success (e.g., directory created or writable).
-  bool init(const std::string &dir, size_t max_files, size_t buffer_threshold_bytes = 1024);
+  bool init(const std::string &dir, size_t max_files, size_t buffer_threshold_bytes = 1024,
+            size_t max_file_bytes = 256 * 1024);
+
+  // Initialize in crash-safe ring file mode (see notes). max_file_bytes applies to the log.N
+  // text files the ring is converted into.
+  bool init_ring(const std::string &dir, size_t max_files, size_t ring_bytes = 256 * 1024,
+                 size_t max_file_bytes = 256 * 1024);
+
+  // Decode a ring file into log.N text format ("<ts> [LEVEL] msg" lines, oldest first).
+  // Returns false if ring_path is missing or is not a ring file.
+  static bool decode_ring(const std::string &ring_path, const std::string &out_path);
+
+  // Initialize from the config's "logging" section: enabled, dir (relative to base_dir),
+  // max_files, max_file_bytes, level ("trace".."error"), subsystems ({"render": false, ...})
+  // lazy_timestamps, and ring/ring_bytes to select crash-safe ring file mode.
+  // With logging.enabled == false every level is switched off and no files are opened.
+  bool init_from_config(const ConfigManager &cfg, const std::string &base_dir);
+
+  // Runtime filtering. set_level() takes effect immediately once initialized.
+  void set_level(LogLevel level);
+  void set_subsystem_mask(uint32_t mask);
+
+  // When enabled, callers store a raw steady_clock stamp and the flusher formats the
+  // timestamp prefix at write time (keeps gmtime/formatting off the caller's thread).
+  void set_lazy_timestamps(bool lazy);
+  static LogLevel level_from_string(const std::string &name, LogLevel fallback = LogLevel::INFO);
+
+  // Cheap check used by the LOG_* macros before any argument is evaluated.
+  bool enabled(LogLevel level, LogSubsystem sub) const noexcept {
+    return static_cast<int>(level) >= min_level_.load(std::memory_order_relaxed) &&
+           (subsystem_mask_.load(std::memory_order_relaxed) & static_cast<uint32_t>(sub)) != 0;
+  }
+
+  // Append a message at `level` (subject to the runtime level only)
+  void log(LogLevel level, const std::string &msg);
 
   // Append info-level message
   void info(const std::string &msg);
@@ -35,20 +110,40 @@ public:
   // Append error-level message
   void error(const std::string &msg);
 
-  // Force flush/rotation (testing or graceful shutdown)
+  // Force flush (testing or graceful shutdown): drains the ring into log.0 synchronously,
+  // rotating only if the size limit is crossed.
   void rotate_and_flush();
 
 private:
   Logger();
   ~Logger();
 
+  void start_flusher();
+
   // non-copyable
   Logger(const Logger&) = delete;
   Logger& operator=(const Logger&) = delete;
 
+  // effective runtime floor; OFF until init() so uninitialized logging costs one load
+  std::atomic<int> min_level_{static_cast<int>(LogLevel::OFF)};
+  std::atomic<uint32_t> subsystem_mask_{static_cast<uint32_t>(LogSubsystem::ALL)};
+  std::atomic<int> level_{static_cast<int>(LogLevel::INFO)}; // requested level, applied on init
+
   // private impl details in cpp
 };
 
 } // namespace core
 
+#define SLIDERUI_LOG(lvl, sub, expr)                                                          \
+  do {                                                                                        \
+    if (static_cast<int>(::core::LogLevel::lvl) >= SLIDERUI_LOG_MIN_LEVEL &&                  \
+        ::core::Logger::instance().enabled(::core::LogLevel::lvl, ::core::LogSubsystem::sub)) \
+      ::core::Logger::instance().log(::core::LogLevel::lvl, (expr));                        \
+  } while (0)
+
+#define LOG_TRACE(sub, expr) SLIDERUI_LOG(TRACE, sub, expr)
+#define LOG_DEBUG(sub, expr) SLIDERUI_LOG(DEBUG, sub, expr)
+#define LOG_INFO(sub, expr)  SLIDERUI_LOG(INFO, sub, expr)
+#define LOG_ERROR(sub, expr) SLIDERUI_LOG(ERROR, sub, expr)
+
 #endif // SLIDERUI_CORE_LOGGER_H
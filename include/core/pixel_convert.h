@@ -0,0 +1,115 @@
+#pragma once
+#ifndef SLIDERUI_CORE_PIXEL_CONVERT_H
+#define SLIDERUI_CORE_PIXEL_CONVERT_H
+
+#include <cstdint>
+
+namespace core {
+
+/**
+ * Convert `count` tightly packed RGB888 pixels to RGB565.
+ *
+ * - Uses NEON (ARM, __ARM_NEON) or SSE2 (x86, __SSE2__) when available, scalar otherwise;
+ *   all variants produce bit-identical results.
+ * - With `dither` a 4x4 ordered (Bayer) threshold is added before truncation, indexed by
+ *   (x & 3, row & 3), so smooth gradients don't band. `row` is the destination row index
+ *   and `x0` the destination column of the first pixel.
+ */
+void rgb888_to_rgb565_row(const uint8_t *src, uint16_t *dst, int count, bool dither = false,
+                          int row = 0, int x0 = 0);
+
+/**
+ * Portable reference implementation of rgb888_to_rgb565_row (used for the row tails and tests).
+ */
+void rgb888_to_rgb565_row_scalar(const uint8_t *src, uint16_t *dst, int count, bool dither = false,
+                                 int row = 0, int x0 = 0);
+
+/**
+ * 2x2 box downsample of a 32-bit-per-pixel image, e.g. one mip level to the next.
+ *
+ * - Every byte lane is averaged independently with rounding ((a+b+c+d+2) >> 2), so any
+ *   channel order works.
+ * - dst is max(1, src_w / 2) x max(1, src_h / 2); an odd last row/column is dropped and
+ *   a 1-pixel axis is averaged with itself. Pitches are in bytes.
+ * - NEON / SSE2 when available, bit-identical to downsample_2x_32_scalar.
+ */
+void downsample_2x_32(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst, int dst_pitch);
+
+/** Portable reference implementation of downsample_2x_32. */
+void downsample_2x_32_scalar(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst,
+                             int dst_pitch);
+
+/**
+ * downsample_2x_32 for RGB565 images: the same sizes and rounding, per 5/6-bit channel.
+ * All three channels of a pixel are summed at once in one 32-bit word.
+ */
+void downsample_2x_565(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst, int dst_pitch);
+
+enum class BlitFilter { NEAREST, BILINEAR };
+
+/** Rectangle in destination pixels (may extend past the buffer; see `clip`). */
+struct BlitRect {
+  int x = 0, y = 0, w = 0, h = 0;
+};
+
+/**
+ * Scaled blit of a 32-bit-per-pixel image into the rectangle `to` of `dst`.
+ *
+ * - Only pixels inside `clip` are written; clip must lie within the destination buffer.
+ *   Clipping does not shift the image: a partly visible cover samples the same source
+ *   pixels as the unclipped one.
+ * - Source coordinates are stepped in 16.16 fixed point from pixel centres. BILINEAR uses
+ *   8-bit weights, a vertical pass over the visible source span and then a horizontal
+ *   pass, each rounded ((v + 128) >> 8). Byte lanes are independent, so any channel order
+ *   works; alpha is copied, not blended.
+ * - NEON / SSE2 when available, bit-identical to scale_blit_32_scalar.
+ */
+void scale_blit_32(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst, int dst_pitch,
+                   const BlitRect &to, const BlitRect &clip, BlitFilter filter = BlitFilter::BILINEAR);
+
+/** Portable reference implementation of scale_blit_32. */
+void scale_blit_32_scalar(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst,
+                          int dst_pitch, const BlitRect &to, const BlitRect &clip,
+                          BlitFilter filter = BlitFilter::BILINEAR);
+
+/**
+ * scale_blit_32 for 16-bit RGB565 images. NEAREST works for any 16-bit layout; BILINEAR
+ * interpolates all three channels of a pixel at once in one 32-bit word (5-bit weights).
+ */
+void scale_blit_16(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst, int dst_pitch,
+                   const BlitRect &to, const BlitRect &clip, BlitFilter filter = BlitFilter::BILINEAR);
+
+/**
+ * Alpha blending over a w x h destination area (translucent fills, glow masks, text).
+ *
+ * - Every channel is mixed as (s * k + d * (256 - k) + 128) >> 8 with k = a + (a >> 7),
+ *   so alpha 255 replaces the destination and 0 leaves it untouched. With a mask, the
+ *   alpha of a pixel is round(mask * alpha / 255).
+ * - 32-bit variants mix every byte lane the same way (any channel order; the destination's
+ *   fourth byte is mixed too). 565 variants mix the 5/6-bit channels.
+ * - NEON / SSE2 when available, bit-identical to the _scalar versions.
+ */
+
+// Blend `pixel` (in the destination format, e.g. from SDL_MapRGB) with constant `alpha`,
+// optionally scaled per pixel by an 8-bit coverage `mask`.
+void blend_color_32(uint8_t *dst, int dst_pitch, int w, int h, uint32_t pixel, uint8_t alpha,
+                    const uint8_t *mask = nullptr, int mask_pitch = 0);
+void blend_color_32_scalar(uint8_t *dst, int dst_pitch, int w, int h, uint32_t pixel, uint8_t alpha,
+                           const uint8_t *mask = nullptr, int mask_pitch = 0);
+void blend_color_565(uint8_t *dst, int dst_pitch, int w, int h, uint16_t pixel, uint8_t alpha,
+                     const uint8_t *mask = nullptr, int mask_pitch = 0);
+void blend_color_565_scalar(uint8_t *dst, int dst_pitch, int w, int h, uint16_t pixel, uint8_t alpha,
+                            const uint8_t *mask = nullptr, int mask_pitch = 0);
+
+// Per-pixel alpha blit of 32-bit pixels with alpha in the top byte (ARGB8888). The color
+// bytes must be in the destination's order.
+void blend_argb_32(const uint8_t *src, int src_pitch, uint8_t *dst, int dst_pitch, int w, int h);
+void blend_argb_32_scalar(const uint8_t *src, int src_pitch, uint8_t *dst, int dst_pitch, int w, int h);
+
+// Per-pixel alpha blit of ARGB8888 onto RGB565 (source reduced to 5/6 bits, then mixed).
+void blend_argb_565(const uint8_t *src, int src_pitch, uint8_t *dst, int dst_pitch, int w, int h);
+void blend_argb_565_scalar(const uint8_t *src, int src_pitch, uint8_t *dst, int dst_pitch, int w, int h);
+
+} // namespace core
+
+#endif // SLIDERUI_CORE_PIXEL_CONVERT_H
@@ -0,0 +1,73 @@
+#pragma once
+#ifndef SLIDERUI_CORE_THREAD_POOL_H
+#define SLIDERUI_CORE_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace core {
+
+/**
+ * ThreadPool - fixed set of worker threads fed from a FIFO queue.
+ *
+ * Usage:
+ *   ThreadPool pool(4);
+ *   auto f = pool.submit([] { return 42; });
+ *   pool.parallel_for(paths.size(), [&](size_t i) { work(paths[i]); }, 2);
+ *
+ * Notes:
+ * - submit() returns a std::future; exceptions thrown by the task are stored in it.
+ * - parallel_for() runs on the calling thread plus up to max_parallel - 1 workers and only
+ *   waits for the items themselves, so it is safe to call from inside a pool task. The
+ *   first exception thrown by an item is rethrown once every item has run.
+ * - The destructor finishes the queued tasks, then joins the workers.
+ */
+class ThreadPool {
+public:
+  // threads == 0 => one per hardware thread (at least one)
+  explicit ThreadPool(unsigned threads = 0);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  unsigned size() const { return static_cast<unsigned>(workers_.size()); }
+
+  template <typename F>
+  std::future<typename std::invoke_result<F>::type> submit(F &&fn) {
+    using R = typename std::invoke_result<F>::type;
+    auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+    std::future<R> fut = task->get_future();
+    enqueue([task] { (*task)(); });
+    return fut;
+  }
+
+  // Call fn(i) for every i in [0, count) using at most max_parallel threads, the caller
+  // included (0 => size() + 1). Blocks until all items are done.
+  void parallel_for(size_t count, const std::function<void(size_t)> &fn, unsigned max_parallel = 0);
+
+  // Process-wide pool (one worker per hardware thread, minus the caller), created on first use.
+  static ThreadPool &shared();
+
+private:
+  void enqueue(std::function<void()> job);
+  void worker_loop();
+
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void()>> queue_;
+  std::mutex mtx_;
+  std::condition_variable cv_;
+  bool stopping_ = false;
+};
+
+} // namespace core
+
+#endif // SLIDERUI_CORE_THREAD_POOL_H
@@ -0,0 +1,93 @@
+#pragma once
+#ifndef SLIDERUI_UI_CAROUSEL_ANIM_H
+#define SLIDERUI_UI_CAROUSEL_ANIM_H
+
+#include <string>
+
+namespace core { class ConfigManager; }
+
+namespace ui {
+
+enum class Easing { LINEAR, EASE_OUT_CUBIC, EASE_IN_OUT_QUAD };
+
+/** "linear" / "ease_out_cubic" / "ease_in_out_quad"; anything else gives `fallback`. */
+Easing easing_from_string(const std::string &name, Easing fallback = Easing::EASE_OUT_CUBIC);
+
+/** Eased progress for t in [0, 1] (clamped). */
+float ease(Easing e, float t);
+
+/**
+ * CarouselAnimator - eased carousel scroll advanced with a fixed timestep.
+ *
+ * The carousel is drawn with every slot shifted by scroll() slots: slot `rel` (relative to
+ * the active item) is centered at rel + scroll(). Moving the selection by `delta` items
+ * calls shift(delta): the scroll jumps by +delta so the picture doesn't move, then eases
+ * back to 0. A shift while the previous one is still running (key repeat) retargets from
+ * the current, in-flight position instead of snapping.
+ *
+ * Usage per frame:
+ *   anim.advance(frame_ms);          // runs 0..n fixed steps of step_ms
+ *   draw(anim.scroll());             // sampled between steps (no judder at any frame rate)
+ */
+class CarouselAnimator {
+public:
+    CarouselAnimator(float duration_ms = 180.f, float step_ms = 1000.f / 120.f,
+                     Easing easing = Easing::EASE_OUT_CUBIC);
+
+    // ui.animation.{duration_ms, easing}
+    void configure(const core::ConfigManager &cfg);
+
+    // Selection moved by `delta` items (+1 = RIGHT, -1 = LEFT)
+    void shift(int delta);
+
+    // Add elapsed wall time; runs whole fixed steps, keeps the remainder for sampling.
+    // Large gaps (e.g. after a stall) are clamped to 100ms so nothing jumps.
+    void advance(float elapsed_ms);
+
+    // Current scroll in slots (0 when settled), interpolated within the current step.
+    float scroll() const;
+
+    bool animating() const { return from_ != 0.f; }
+    void reset();
+
+    float duration_ms() const { return duration_ms_; }
+    float step_ms() const { return step_ms_; }
+
+private:
+    float value_at(float t_ms) const;
+
+    float duration_ms_;
+    float step_ms_;
+    Easing easing_;
+    float from_ = 0.f;   // scroll at t = 0 of the current segment
+    float t_ms_ = 0.f;   // simulated time in the segment (whole steps)
+    float acc_ms_ = 0.f; // wall time not yet simulated (< step_ms_)
+};
+
+/**
+ * FramePacer - fixed frame period based on measured frame time instead of a flat sleep.
+ * wait() sleeps only for what is left of the period after input/update/render, and
+ * resynchronises instead of bursting when a frame overruns.
+ */
+class FramePacer {
+public:
+    explicit FramePacer(int fps = 60);
+
+    // Sleep until the next frame boundary; returns the elapsed ms since the previous wait()
+    // (the dt to feed CarouselAnimator::advance).
+    float wait();
+
+    // Time the last frame spent before calling wait() (input + update + render)
+    float last_work_ms() const { return last_work_ms_; }
+    float period_ms() const { return period_ms_; }
+
+private:
+    float period_ms_;
+    double next_ms_ = 0;  // next frame boundary (steady clock, ms)
+    double prev_ms_ = 0;  // previous wait() return
+    float last_work_ms_ = 0.f;
+};
+
+} // namespace ui
+
+#endif // SLIDERUI_UI_CAROUSEL_ANIM_H
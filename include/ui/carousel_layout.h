@@ -0,0 +1,167 @@
+#pragma once
+#ifndef SLIDERUI_UI_CAROUSEL_LAYOUT_H
+#define SLIDERUI_UI_CAROUSEL_LAYOUT_H
+
+#include "core/canvas.h"
+#include "core/pixel_convert.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace core { class ConfigManager; }
+namespace core { struct Game; }
+
+namespace ui {
+
+/**
+ * CarouselStyle - carousel geometry and decoration read from the config, shared by the
+ * renderer backends so they lay out identical frames. The other frame pieces below
+ * (slots, glow, overlay, button bar, selector, background) are decided here too, down to
+ * their DrawHash; the backends only rasterize them.
+ */
+struct CarouselStyle {
+    int center_x = 320;
+    int center_y = 220;
+    int active_w = 360;
+    int active_h = 200;
+    int side_w = 220;
+    int side_h = 140;
+    int spacing = 24;
+    core::BlitFilter filter = core::BlitFilter::BILINEAR;
+    // ui.selected_contour: glow around the focused slot's frame and its outline
+    bool glow = true;
+    uint8_t glow_rgb[3] = {0x33, 0x66, 0x99};
+    uint8_t glow_alpha = 160;
+    core::ShapeStyle contour;
+};
+
+// Frame border drawn around every slot, and the glow's reach beyond it
+constexpr int kCarouselFrame = 6;
+constexpr int kCarouselGlowSpread = 12;
+
+// ui.game_image.{x, y, width, height, margin, side_scale}, ui.animation.filter and
+// ui.selected_contour.*; defaults (cfg == nullptr) center on a screen_w x screen_h screen
+CarouselStyle carousel_style(const core::ConfigManager *cfg, int screen_w, int screen_h);
+
+/**
+ * One drawn slot. Slot i sits at p = (i - active) + scroll slots from the center; its size
+ * goes from the active size at p = 0 to the side size at |p| >= 1.
+ */
+struct CarouselSlot {
+    size_t index = 0;       // into the games passed to draw_game_carousel
+    float p = 0.f;          // position in slots from the center
+    bool focused = false;   // |p| < 0.5
+    bool prefitted = false; // exactly the active or side size (covers blit 1:1)
+    int x = 0, y = 0, w = 0, h = 0;
+};
+
+// Slots of `count` games in draw order: outermost first, so the one nearest the center
+// ends on top
+std::vector<CarouselSlot> carousel_slots(size_t count, size_t active_index, float scroll, const CarouselStyle &st);
+
+// Cover for a game: assets/img/<label>.{png,jpg,jpeg,webp} next to the executable, else
+// the game's own path
+std::string carousel_art_path(const core::Game &g);
+// Label shown for a game: its name, else the file name of its path
+std::string game_label(const core::Game &g);
+
+/**
+ * What a backend rasterizes for one slot: the frame rect filled with kCarouselFrameRgb,
+ * the cover scaled into the slot (or the placeholder color) and, on the settled focused
+ * slot, st.contour over the frame rect, recorded as one command.
+ */
+struct SlotDraw {
+    core::BlitRect bounds;          // the slot plus kCarouselFrame on each side
+    uint8_t placeholder[3] = {0, 0, 0};
+    bool contour = false;
+    uint64_t hash = 0;              // DrawHash of all of the above
+    int label_x = 0, label_y = 0;   // game_label() position, highlighted when focused
+};
+
+constexpr uint8_t kCarouselFrameRgb[3] = {30, 30, 30};
+
+// has_art: a cover of `art_path` is drawn. The cover is identified by its path and size:
+// the pixels of a cached size never change.
+SlotDraw carousel_slot_draw(const CarouselSlot &slot, const CarouselStyle &st, const std::string &art_path, bool has_art);
+
+// One glow blend: `alpha` over the mask placed at `rect`
+struct GlowDraw {
+    core::BlitRect rect;
+    uint8_t alpha = 0;
+    uint64_t hash = 0;
+};
+
+/**
+ * CarouselGlow - glow around the focused slot's frame: one coverage mask (core::glow_mask)
+ * at the active size, rebuilt when that size changes and blended every frame.
+ */
+class CarouselGlow {
+public:
+    // Rebuild the mask if st's active size changed
+    void update(const CarouselStyle &st);
+    // The glow of focused `slot`, fading out as it moves off the center
+    GlowDraw draw(const CarouselSlot &slot, const CarouselStyle &st) const;
+    const uint8_t *mask() const { return mask_.data(); }
+    int mask_pitch() const { return frame_w_ + 2 * kCarouselGlowSpread; }
+
+private:
+    std::vector<uint8_t> mask_;
+    int frame_w_ = 0;
+    int frame_h_ = 0;
+};
+
+// draw_overlay: the screen dimmed, then a translucent dark box the message is written into
+struct OverlayLayout {
+    core::BlitRect dim;
+    uint8_t dim_alpha = 128;
+    uint64_t dim_hash = 0;
+    core::BlitRect box;
+    uint8_t box_rgb[3] = {12, 12, 12};
+    uint8_t box_alpha = 220;
+    uint64_t box_hash = 0;
+    int text_x = 0, text_y = 0;
+};
+
+OverlayLayout overlay_layout(int screen_w, int screen_h);
+
+// draw_button_bar: `rgba` blended over `bar`, the hints written at (text_x, text_y)
+struct ButtonBarLayout {
+    core::BlitRect bar;
+    uint8_t rgba[4] = {0, 0, 0, 0xAA};
+    uint64_t hash = 0;
+    int text_x = 0, text_y = 0;
+};
+
+// ui.buttons: (x, y) anchors the text, `align` says which edge x is; the bar is the
+// text_w x text_h hints plus `padding` on each side over `background` (#RRGGBBAA), kept
+// on screen whatever the anchor says
+ButtonBarLayout button_bar_layout(const core::ConfigManager *cfg, int screen_w, int screen_h, int text_w, int text_h);
+
+// draw_selector: gray pill with a darker 1px border and a highlight row inside the top edge
+core::ShapeStyle selector_style(int h);
+// DrawHash of a ShapeStyle sprite drawn over `r`
+uint64_t shape_hash(const core::BlitRect &r, const core::ShapeStyle &st);
+
+/**
+ * BackgroundSource - what draw_background's image was loaded from. A new path reloads
+ * right away; the current file is re-stat'ed at most once a second and reloaded when its
+ * mtime changes.
+ */
+struct BackgroundSource {
+    std::string path;
+    uint64_t mtime = 0;
+    std::chrono::steady_clock::time_point checked;
+
+    // True when `image` has to be (re)loaded now; records it as the current source
+    bool needs_reload(const std::string &image);
+    // DrawHash of the background drawn from the current source
+    uint64_t hash() const;
+    void reset() { path.clear(); mtime = 0; }
+};
+
+} // namespace ui
+
+#endif // SLIDERUI_UI_CAROUSEL_LAYOUT_H
@@ -0,0 +1,89 @@
+#pragma once
+#ifndef SLIDERUI_UI_DRAW_LIST_H
+#define SLIDERUI_UI_DRAW_LIST_H
+
+#include "core/pixel_convert.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ui {
+
+/** FNV-1a over the parameters of a draw command: equal hashes => identical pixels. */
+class DrawHash {
+public:
+    DrawHash &add(const void *data, size_t size);
+    DrawHash &add(int v) { return add(&v, sizeof(v)); }
+    DrawHash &add(uint64_t v) { return add(&v, sizeof(v)); }
+    DrawHash &add(const std::string &s) { add(static_cast<uint64_t>(s.size())); return add(s.data(), s.size()); }
+    DrawHash &add(const core::BlitRect &r) { return add(r.x).add(r.y).add(r.w).add(r.h); }
+    uint64_t value() const { return h_; }
+
+private:
+    uint64_t h_ = 14695981039346656037ull;
+};
+
+/**
+ * DrawList - retained draw commands for one frame, diffed against the previous frame.
+ *
+ * The renderer records each draw call as (bounds, hash, draw) instead of rasterizing it.
+ * At present() end_frame() folds the hashes of the commands touching each screen tile, in
+ * order, and compares them with the previous frame's: the tiles that differ, merged into
+ * rects, are the only parts that need rasterizing. replay() then runs the commands that
+ * intersect such a region with the target clipped to it. An unchanged frame yields no
+ * regions, so neither rasterization nor the flip happen.
+ *
+ * Commands must not touch pixels outside `bounds`, and their hash must cover everything
+ * their pixels depend on (position, colors, text, which image).
+ *
+ * Usage per frame:
+ *   list.add(bounds, hash, [=] { ... rasterize ... });   // per draw call
+ *   for (const core::BlitRect &r : list.end_frame()) { set_clip(r); list.replay(r); }
+ */
+class DrawList {
+public:
+    using Draw = std::function<void()>;
+
+    // Screen size and tile edge; the next end_frame() reports the whole screen
+    void set_screen(int width, int height, int tile = 32);
+
+    // Record a command; the first add() after end_frame() starts a new frame
+    void add(const core::BlitRect &bounds, uint64_t hash, Draw draw);
+
+    size_t size() const { return ended_ ? 0 : cmds_.size(); }
+
+    // Close the frame: the changed regions (tile aligned, clipped to the screen), empty when
+    // nothing changed or nothing was recorded. The commands stay available to replay().
+    std::vector<core::BlitRect> end_frame();
+
+    // Run, in recording order, the commands of the closed frame that intersect `region`
+    void replay(const core::BlitRect &region) const;
+
+    // Forget the previous frame (the target lost its contents): the next end_frame()
+    // reports the whole screen
+    void invalidate();
+
+private:
+    struct Command {
+        core::BlitRect bounds;
+        uint64_t hash;
+        Draw draw;
+    };
+
+    int width_ = 0;
+    int height_ = 0;
+    int tile_ = 32;
+    int cols_ = 0;
+    int rows_ = 0;
+    bool ended_ = false;
+    std::vector<Command> cmds_;
+    std::vector<uint64_t> tiles_;      // this frame's per-tile hashes
+    std::vector<uint64_t> prev_tiles_; // last frame's; empty => everything changed
+};
+
+} // namespace ui
+
+#endif // SLIDERUI_UI_DRAW_LIST_H
@@ -38,15 +38,23 @@ public:
     bool init();
     void shutdown();
 
-    // Frame lifecycle
+    // Frame lifecycle. Draw calls are recorded and rasterized by present(), only in the
+    // screen regions whose draw calls differ from the previous frame's; a frame identical to
+    // the last one is neither drawn nor presented.
     void clear();
     void present();
 
     // Drawing helpers
+    // Full-screen image, scaled to the screen and converted to its format once (reloaded when
+    // the path or the file's mtime changes); replaces clear(). Empty path => clear().
     void draw_background(const std::string &background_image);
-    void draw_game_carousel(const std::vector<core::Game> &games, size_t active_index, core::ImageCache *cache);
+    // scroll: fractional slot offset while the carousel animates (see CarouselAnimator)
+    void draw_game_carousel(const std::vector<core::Game> &games, size_t active_index, core::ImageCache *cache,
+                            float scroll = 0.f);
     void draw_text(int x, int y, const std::string &s, bool highlight = false);
     void draw_overlay(const std::string &message);
+    // Control hints on a translucent bar, placed and styled by ui.buttons
+    void draw_button_bar(const std::string &hints);
 
     // Methods required by menu_ui.cpp
     void draw_selector(int x, int y, int w, int h);
@@ -0,0 +1,130 @@
+// src/core/atlas_packer.cpp
+#include "core/atlas_packer.h"
+
+#include <algorithm>
+#include <climits>
+
+namespace core {
+
+AtlasPacker::AtlasPacker(int width, int height) { reset(width, height); }
+
+void AtlasPacker::reset(int width, int height) {
+  width_ = std::max(0, width);
+  height_ = std::max(0, height);
+  skyline_.assign(1, Node{0, 0, width_});
+  free_.clear();
+  entries_.clear();
+}
+
+void AtlasPacker::begin_frame() { ++frame_; }
+
+bool AtlasPacker::find(const std::string &id, AtlasRect &out) {
+  auto it = entries_.find(id);
+  if (it == entries_.end()) return false;
+  it->second.last_used = frame_;
+  out = it->second.rect;
+  return true;
+}
+
+bool AtlasPacker::place_skyline(int w, int h, AtlasRect &out) {
+  int best = -1, best_top = INT_MAX, best_x = INT_MAX;
+  for (size_t i = 0; i < skyline_.size(); ++i) {
+    const int x = skyline_[i].x;
+    if (x + w > width_) break;
+    // resting height: highest segment under [x, x + w)
+    int y = 0;
+    for (size_t j = i, left = static_cast<size_t>(w); left > 0 && j < skyline_.size(); ++j) {
+      y = std::max(y, skyline_[j].y);
+      left -= std::min(left, static_cast<size_t>(skyline_[j].w));
+    }
+    if (y + h > height_) continue;
+    if (y + h < best_top || (y + h == best_top && x < best_x)) {
+      best = static_cast<int>(i);
+      best_top = y + h;
+      best_x = x;
+    }
+  }
+  if (best < 0) return false;
+
+  out = AtlasRect{best_x, best_top - h, w, h};
+  // raise [x, x + w) to the new top, trimming the segments it covers
+  skyline_.insert(skyline_.begin() + best, Node{best_x, best_top, w});
+  for (size_t i = best + 1; i < skyline_.size();) {
+    Node &n = skyline_[i];
+    const int end = best_x + w;
+    if (n.x >= end) break;
+    const int cut = std::min(n.w, end - n.x);
+    n.x += cut;
+    n.w -= cut;
+    if (n.w == 0) skyline_.erase(skyline_.begin() + i);
+    else break;
+  }
+  for (size_t i = 0; i + 1 < skyline_.size();) { // merge equal heights
+    if (skyline_[i].y == skyline_[i + 1].y) {
+      skyline_[i].w += skyline_[i + 1].w;
+      skyline_.erase(skyline_.begin() + i + 1);
+    } else {
+      ++i;
+    }
+  }
+  return true;
+}
+
+bool AtlasPacker::place_free(int w, int h, AtlasRect &slot) {
+  size_t best = free_.size();
+  long best_area = 0;
+  for (size_t i = 0; i < free_.size(); ++i) {
+    const AtlasRect &f = free_[i];
+    if (f.w < w || f.h < h) continue;
+    const long area = static_cast<long>(f.w) * f.h;
+    if (best == free_.size() || area < best_area) {
+      best = i;
+      best_area = area;
+    }
+  }
+  if (best == free_.size()) return false;
+  slot = free_[best];
+  free_.erase(free_.begin() + best);
+  return true;
+}
+
+bool AtlasPacker::evict_lru() {
+  auto victim = entries_.end();
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (it->second.last_used >= frame_) continue; // pinned by this frame
+    if (victim == entries_.end() || it->second.last_used < victim->second.last_used) victim = it;
+  }
+  if (victim == entries_.end()) return false;
+  free_.push_back(victim->second.slot);
+  entries_.erase(victim);
+  ++evictions_;
+  if (entries_.empty()) reset(width_, height_);
+  return true;
+}
+
+bool AtlasPacker::insert(const std::string &id, int w, int h, AtlasRect &out) {
+  if (find(id, out)) return true;
+  if (w <= 0 || h <= 0 || w > width_ || h > height_) return false;
+
+  Entry e;
+  for (;;) {
+    if (place_free(w, h, e.slot)) break;
+    if (place_skyline(w, h, e.slot)) break;
+    if (!evict_lru()) return false;
+  }
+  e.rect = AtlasRect{e.slot.x, e.slot.y, w, h};
+  e.last_used = frame_;
+  entries_[id] = e;
+  out = e.rect;
+  return true;
+}
+
+void AtlasPacker::evict(const std::string &id) {
+  auto it = entries_.find(id);
+  if (it == entries_.end()) return;
+  free_.push_back(it->second.slot);
+  entries_.erase(it);
+  if (entries_.empty()) reset(width_, height_);
+}
+
+} // namespace core
@@ -0,0 +1,258 @@
+// src/core/canvas.cpp
+#include "core/canvas.h"
+#include "core/file_utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace core {
+
+Canvas::Canvas(int width, int height, int bpp) { reset(width, height, bpp); }
+
+void Canvas::reset(int width, int height, int bpp) {
+  w_ = std::max(0, width);
+  h_ = std::max(0, height);
+  bpp_ = bpp == 16 ? 16 : 32;
+  pitch_ = w_ * bytes_per_pixel();
+  clip_ = BlitRect{0, 0, w_, h_};
+  pixels_.assign(static_cast<size_t>(pitch_) * h_, 0);
+}
+
+void Canvas::set_clip(const BlitRect &clip) {
+  const int x0 = std::max(0, clip.x), y0 = std::max(0, clip.y);
+  const int x1 = std::min(w_, clip.x + clip.w), y1 = std::min(h_, clip.y + clip.h);
+  clip_ = BlitRect{x0, y0, std::max(0, x1 - x0), std::max(0, y1 - y0)};
+}
+
+uint32_t Canvas::map_rgb(uint8_t r, uint8_t g, uint8_t b) const {
+  if (bpp_ == 16) return static_cast<uint32_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+  return (static_cast<uint32_t>(r) << 16) | (static_cast<uint32_t>(g) << 8) | b;
+}
+
+void Canvas::get_rgb(int x, int y, uint8_t &r, uint8_t &g, uint8_t &b) const {
+  r = g = b = 0;
+  if (x < 0 || y < 0 || x >= w_ || y >= h_) return;
+  const uint8_t *p = pixels_.data() + static_cast<size_t>(y) * pitch_ + x * bytes_per_pixel();
+  if (bpp_ == 16) {
+    uint16_t v;
+    std::memcpy(&v, p, 2);
+    const unsigned r5 = v >> 11, g6 = (v >> 5) & 63, b5 = v & 31;
+    r = static_cast<uint8_t>((r5 << 3) | (r5 >> 2));
+    g = static_cast<uint8_t>((g6 << 2) | (g6 >> 4));
+    b = static_cast<uint8_t>((b5 << 3) | (b5 >> 2));
+  } else {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    r = static_cast<uint8_t>(v >> 16);
+    g = static_cast<uint8_t>(v >> 8);
+    b = static_cast<uint8_t>(v);
+  }
+}
+
+// Intersect (x, y, w, h) with `clip`; false when nothing is left
+static bool clip_rect(const BlitRect &clip, int &x, int &y, int &w, int &h) {
+  const int x1 = std::min(x + w, clip.x + clip.w), y1 = std::min(y + h, clip.y + clip.h);
+  x = std::max(x, clip.x);
+  y = std::max(y, clip.y);
+  w = x1 - x;
+  h = y1 - y;
+  return w > 0 && h > 0;
+}
+
+void Canvas::fill_rect(int x, int y, int w, int h, uint8_t r, uint8_t g, uint8_t b) {
+  if (!clip_rect(clip_, x, y, w, h)) return;
+  const uint32_t px = map_rgb(r, g, b);
+  for (int row = y; row < y + h; ++row) {
+    uint8_t *p = pixels_.data() + static_cast<size_t>(row) * pitch_;
+    if (bpp_ == 16) std::fill_n(reinterpret_cast<uint16_t *>(p) + x, w, static_cast<uint16_t>(px));
+    else std::fill_n(reinterpret_cast<uint32_t *>(p) + x, w, px);
+  }
+}
+
+void Canvas::blend_rect(int x, int y, int w, int h, uint8_t r, uint8_t g, uint8_t b, uint8_t a,
+                        const uint8_t *mask, int mask_pitch) {
+  if (a == 0) return;
+  const int x0 = x, y0 = y;
+  if (!clip_rect(clip_, x, y, w, h)) return;
+  if (mask) mask += static_cast<size_t>(y - y0) * mask_pitch + (x - x0);
+  uint8_t *p = pixels_.data() + static_cast<size_t>(y) * pitch_ + x * bytes_per_pixel();
+  if (bpp_ == 16) blend_color_565(p, pitch_, w, h, static_cast<uint16_t>(map_rgb(r, g, b)), a, mask, mask_pitch);
+  else blend_color_32(p, pitch_, w, h, map_rgb(r, g, b), a, mask, mask_pitch);
+}
+
+bool Canvas::blit(const Canvas &src, const BlitRect &from, int x, int y) {
+  if (src.bpp_ != bpp_) return false;
+  // clip the source rect to src, then the destination to our clip rect
+  int sx = from.x, sy = from.y, w = from.w, h = from.h;
+  if (!clip_rect(BlitRect{0, 0, src.w_, src.h_}, sx, sy, w, h)) return true;
+  x += sx - from.x;
+  y += sy - from.y;
+  const int dx0 = x, dy0 = y;
+  if (!clip_rect(clip_, x, y, w, h)) return true;
+  sx += x - dx0;
+  sy += y - dy0;
+  const int bp = bytes_per_pixel();
+  for (int row = 0; row < h; ++row) {
+    std::memcpy(pixels_.data() + static_cast<size_t>(y + row) * pitch_ + x * bp,
+                src.pixels_.data() + static_cast<size_t>(sy + row) * src.pitch_ + sx * bp, static_cast<size_t>(w) * bp);
+  }
+  return true;
+}
+
+bool Canvas::blit_scaled(const Canvas &src, const BlitRect &to, BlitFilter filter) {
+  if (src.bpp_ != bpp_) return false;
+  if (src.empty() || to.w <= 0 || to.h <= 0) return true;
+  if (src.w_ == to.w && src.h_ == to.h) return blit(src, to.x, to.y);
+  if (bpp_ == 16) scale_blit_16(src.data(), src.w_, src.h_, src.pitch_, data(), pitch_, to, clip_, filter);
+  else scale_blit_32(src.data(), src.w_, src.h_, src.pitch_, data(), pitch_, to, clip_, filter);
+  return true;
+}
+
+void Canvas::blend_argb(const uint32_t *argb, int src_pitch, int w, int h, int x, int y) {
+  if (!argb) return;
+  const int x0 = x, y0 = y;
+  if (!clip_rect(clip_, x, y, w, h)) return;
+  const uint8_t *s = reinterpret_cast<const uint8_t *>(argb) + static_cast<size_t>(y - y0) * src_pitch + (x - x0) * 4;
+  uint8_t *d = pixels_.data() + static_cast<size_t>(y) * pitch_ + x * bytes_per_pixel();
+  if (bpp_ == 16) blend_argb_565(s, src_pitch, d, pitch_, w, h);
+  else blend_argb_32(s, src_pitch, d, pitch_, w, h);
+}
+
+bool Canvas::load_image(const uint8_t *pixels, int width, int height, int channels, bool dither, uint32_t matte) {
+  if (!pixels || width <= 0 || height <= 0 || (channels != 3 && channels != 4)) return false;
+  reset(width, height, bpp_);
+  const unsigned mr = (matte >> 16) & 0xFF, mg = (matte >> 8) & 0xFF, mb = matte & 0xFF;
+  std::vector<uint8_t> rgb(static_cast<size_t>(width) * 3);
+  for (int y = 0; y < height; ++y) {
+    const uint8_t *src = pixels + static_cast<size_t>(y) * width * channels;
+    for (int x = 0; x < width; ++x, src += channels) {
+      const unsigned a = channels == 4 ? src[3] : 255;
+      rgb[x * 3 + 0] = static_cast<uint8_t>((src[0] * a + mr * (255 - a) + 127) / 255);
+      rgb[x * 3 + 1] = static_cast<uint8_t>((src[1] * a + mg * (255 - a) + 127) / 255);
+      rgb[x * 3 + 2] = static_cast<uint8_t>((src[2] * a + mb * (255 - a) + 127) / 255);
+    }
+    uint8_t *row = pixels_.data() + static_cast<size_t>(y) * pitch_;
+    if (bpp_ == 16) {
+      rgb888_to_rgb565_row(rgb.data(), reinterpret_cast<uint16_t *>(row), width, dither, y);
+    } else {
+      uint32_t *out = reinterpret_cast<uint32_t *>(row);
+      for (int x = 0; x < width; ++x) out[x] = map_rgb(rgb[x * 3], rgb[x * 3 + 1], rgb[x * 3 + 2]);
+    }
+  }
+  return true;
+}
+
+bool Canvas::load_file(const std::string &path, int w, int h, ScaleMode mode, bool dither) {
+  if (w <= 0 || h <= 0) return false;
+  file_utils::MappedFile file;
+  if (!file.open(path)) return false;
+  std::vector<unsigned char> rgb;
+  int iw = 0, ih = 0;
+  if (!decode_image_memory(file.data(), file.size(), 3, w, h, rgb, iw, ih, path, mode)) return false;
+  file.close();
+  const std::vector<unsigned char> fitted = resample_rgb_scaled(rgb.data(), iw, ih, w, h, mode);
+  if (fitted.size() != static_cast<size_t>(w) * h * 3) return false;
+  return load_image(fitted.data(), w, h, 3, dither);
+}
+
+Canvas Canvas::downsample_2x() const {
+  Canvas out(std::max(1, w_ / 2), std::max(1, h_ / 2), bpp_);
+  if (empty()) return out;
+  if (bpp_ == 16) downsample_2x_565(data(), w_, h_, pitch_, out.data(), out.pitch_);
+  else downsample_2x_32(data(), w_, h_, pitch_, out.data(), out.pitch_);
+  return out;
+}
+
+bool Canvas::write_ppm(const std::string &path) const {
+  FILE *f = std::fopen(path.c_str(), "wb");
+  if (!f) return false;
+  std::fprintf(f, "P6\n%d %d\n255\n", w_, h_);
+  std::vector<uint8_t> row(static_cast<size_t>(w_) * 3);
+  bool ok = true;
+  for (int y = 0; y < h_ && ok; ++y) {
+    for (int x = 0; x < w_; ++x) get_rgb(x, y, row[x * 3], row[x * 3 + 1], row[x * 3 + 2]);
+    ok = std::fwrite(row.data(), 1, row.size(), f) == row.size();
+  }
+  return std::fclose(f) == 0 && ok;
+}
+
+bool parse_hex_color(const std::string &s, uint8_t &r, uint8_t &g, uint8_t &b, uint8_t &a) {
+  if ((s.size() != 7 && s.size() != 9) || s[0] != '#') return false;
+  unsigned v[4] = {0, 0, 0, 255};
+  for (size_t i = 1, c = 0; i < s.size(); i += 2, ++c) {
+    const std::string byte = s.substr(i, 2);
+    char *end = nullptr;
+    v[c] = static_cast<unsigned>(std::strtoul(byte.c_str(), &end, 16));
+    if (*end != '\0') return false;
+  }
+  r = static_cast<uint8_t>(v[0]);
+  g = static_cast<uint8_t>(v[1]);
+  b = static_cast<uint8_t>(v[2]);
+  a = static_cast<uint8_t>(v[3]);
+  return true;
+}
+
+std::string shape_key(int w, int h, const ShapeStyle &st) {
+  std::string key = std::to_string(w) + "x" + std::to_string(h) + ":" + std::to_string(st.radius) + ":" +
+                    std::to_string(st.stroke);
+  for (const uint8_t *c : {st.border, st.fill, st.hi}) {
+    for (int i = 0; i < 3; ++i) key += ":" + std::to_string(c[i]);
+  }
+  key += st.hollow ? ":h" : ":f";
+  key += st.highlight ? "1" : "0";
+  return key;
+}
+
+// Coverage of pixel (px, py) by the rect [0, w) x [0, h) inset by `inset`, corners rounded
+// to `radius`
+static float rounded_coverage(int px, int py, int w, int h, int inset, int radius) {
+  const float hx = w * 0.5f - inset, hy = h * 0.5f - inset;
+  if (hx <= 0.f || hy <= 0.f) return 0.f;
+  const float r = std::max(0.f, std::min(static_cast<float>(radius - inset), std::min(hx, hy)));
+  const float qx = std::fabs(px + 0.5f - w * 0.5f) - (hx - r);
+  const float qy = std::fabs(py + 0.5f - h * 0.5f) - (hy - r);
+  const float d = std::hypot(std::max(qx, 0.f), std::max(qy, 0.f)) + std::min(std::max(qx, qy), 0.f) - r;
+  return std::max(0.f, std::min(1.f, 0.5f - d));
+}
+
+std::vector<uint32_t> render_shape(int w, int h, const ShapeStyle &st) {
+  std::vector<uint32_t> out(static_cast<size_t>(std::max(0, w)) * std::max(0, h), 0);
+  for (int y = 0; y < h; ++y) {
+    const uint8_t *inner = (st.highlight && y == st.stroke + 1) ? st.hi : st.fill;
+    for (int x = 0; x < w; ++x) {
+      const float outer = rounded_coverage(x, y, w, h, 0, st.radius);
+      const float in = rounded_coverage(x, y, w, h, st.stroke, st.radius);
+      const float a = st.hollow ? outer - in : outer;
+      if (a <= 0.f) continue;
+      // border over the ring, inner color over the rest (fill already weighted by `in`)
+      const float kb = (outer - in) / a, ki = st.hollow ? 0.f : in / a;
+      uint32_t px = static_cast<uint32_t>(std::lround(a * 255.f)) << 24;
+      for (int c = 0; c < 3; ++c) {
+        const float v = st.border[c] * kb + inner[c] * ki;
+        px |= static_cast<uint32_t>(std::lround(std::min(255.f, v))) << (16 - 8 * c);
+      }
+      out[static_cast<size_t>(y) * w + x] = px;
+    }
+  }
+  return out;
+}
+
+std::vector<uint8_t> glow_mask(int w, int h, int spread) {
+  const int mw = w + 2 * spread, mh = h + 2 * spread;
+  std::vector<uint8_t> mask(static_cast<size_t>(std::max(0, mw)) * std::max(0, mh), 0);
+  for (int y = 0; y < mh; ++y) {
+    const int dy = std::max(0, std::max(spread - y, y - (spread + h - 1)));
+    for (int x = 0; x < mw; ++x) {
+      const int dx = std::max(0, std::max(spread - x, x - (spread + w - 1)));
+      if (dx == 0 && dy == 0) continue;
+      const double t = 1.0 - std::sqrt(double(dx * dx + dy * dy)) / (spread + 1);
+      if (t > 0) mask[static_cast<size_t>(y) * mw + x] = static_cast<uint8_t>(std::lround(255 * t * t));
+    }
+  }
+  return mask;
+}
+
+} // namespace core
@@ -56,6 +56,13 @@ json make_defaults() {
         {"scale", "fit"},        // Scaling mode: fit/fill
         {"side_scale", 0.78}      // Size multiplier for side images
       }},
+      // Carousel transition when the selection moves
+      {"animation", {
+        {"duration_ms", 180},    // 0 disables the animation
+        {"easing", "ease_out_cubic"}, // linear/ease_out_cubic/ease_in_out_quad
+        {"filter", "bilinear"},  // In-between cover sizes: bilinear/nearest
+        {"fps", 60}              // Frame rate of the main loop
+      }},
       // Selected game highlight
       {"selected_contour", {
         {"stroke", 3},
@@ -95,14 +102,33 @@ json make_defaults() {
       {"release_order", "ascending"}
     }},
     {"platform", {
+      {"color_depth", 32},   // screen and cover surfaces: 32 or 16 (RGB565)
+      {"decode_threads", 0}, // parallel image decodes; 0 => one per core
+      {"dither", true},      // ordered dithering when covers are reduced to RGB565
+      {"headless_dump_dir", ""}, // headless build: write every frame here as PPM
+      {"headless_input", ""},    // headless build: scripted inputs, e.g. "RIGHT,RIGHT,A"
       {"icons_path", ""},
-      {"image_formats", {"png","jpg","webp"}},
+      {"image_formats", {"png","jpg","webp","qoi","rgb565"}},
       {"image_max_dimensions", {640,480}}
     }},
     {"logging", {
       {"enabled", true},
       {"dir", "logs/"},
-      {"max_files", 10}
+      {"max_files", 10},
+      {"max_file_bytes", 262144}, // log.0 is rotated once it would grow past this size
+      {"level", "info"},          // trace/debug/info/error/off
+      {"lazy_timestamps", false}, // format timestamps on the flusher thread
+      {"ring", false},            // crash-safe mmapped ring file (<dir>/ring.bin)
+      {"ring_bytes", 262144},
+      {"subsystems", {            // per-subsystem switches (missing => enabled)
+        {"core", true},
+        {"config", true},
+        {"image", true},
+        {"render", false},        // per-frame draw tracing
+        {"input", true},
+        {"menu", true},
+        {"slider", true}
+      }}
     }}
   };
 }
@@ -0,0 +1,136 @@
+// src/core/cover_formats.cpp
+//
+// Header parsing and encoders for the pre-baked cover formats (QOI, raw RGB565).
+// The decoders live with the other backends in image_loader.cpp.
+
+#include "core/cover_formats.h"
+
+#include <cstring>
+
+namespace core {
+
+static uint32_t read_be32(const unsigned char *p) {
+  return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+static uint32_t read_le32(const unsigned char *p) {
+  return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+static void put_be32(std::vector<unsigned char> &out, uint32_t v) {
+  out.push_back(static_cast<unsigned char>(v >> 24));
+  out.push_back(static_cast<unsigned char>(v >> 16));
+  out.push_back(static_cast<unsigned char>(v >> 8));
+  out.push_back(static_cast<unsigned char>(v));
+}
+
+static void put_le32(std::vector<unsigned char> &out, uint32_t v) {
+  out.push_back(static_cast<unsigned char>(v));
+  out.push_back(static_cast<unsigned char>(v >> 8));
+  out.push_back(static_cast<unsigned char>(v >> 16));
+  out.push_back(static_cast<unsigned char>(v >> 24));
+}
+
+// Upper bound keeps w*h*4 well inside size_t/int ranges on 32-bit targets
+static constexpr uint32_t kMaxCoverPixels = 64u * 1024u * 1024u;
+
+bool parse_qoi_header(const unsigned char *data, size_t size, CoverHeader &out) {
+  if (!data || size < kQoiHeaderSize + 8 || std::memcmp(data, "qoif", 4) != 0) return false;
+  CoverHeader h;
+  h.width = read_be32(data + 4);
+  h.height = read_be32(data + 8);
+  h.channels = data[12];
+  if (h.width == 0 || h.height == 0 || (h.channels != 3 && h.channels != 4) || data[13] > 1) return false;
+  if (h.height > kMaxCoverPixels / h.width) return false;
+  out = h;
+  return true;
+}
+
+bool parse_rgb565_header(const unsigned char *data, size_t size, CoverHeader &out) {
+  if (!data || size < kRgb565HeaderSize || std::memcmp(data, "R565", 4) != 0) return false;
+  if (read_le32(data + 4) != kRgb565Version) return false;
+  CoverHeader h;
+  h.width = read_le32(data + 8);
+  h.height = read_le32(data + 12);
+  h.channels = 3;
+  if (h.width == 0 || h.height == 0 || h.height > kMaxCoverPixels / h.width) return false;
+  if (size - kRgb565HeaderSize < size_t(h.width) * h.height * 2) return false;
+  out = h;
+  return true;
+}
+
+std::vector<unsigned char> encode_qoi(const unsigned char *px, int w, int h, int channels) {
+  std::vector<unsigned char> out;
+  if (!px || w <= 0 || h <= 0 || (channels != 3 && channels != 4)) return out;
+  const size_t npx = size_t(w) * size_t(h);
+  out.reserve(kQoiHeaderSize + npx * (channels + 1) + 8);
+  out.insert(out.end(), {'q', 'o', 'i', 'f'});
+  put_be32(out, uint32_t(w));
+  put_be32(out, uint32_t(h));
+  out.push_back(static_cast<unsigned char>(channels));
+  out.push_back(0); // sRGB with linear alpha
+
+  unsigned char index[64][4];
+  std::memset(index, 0, sizeof(index));
+  unsigned char prev[4] = {0, 0, 0, 255};
+  int run = 0;
+  for (size_t i = 0; i < npx; ++i) {
+    const unsigned char *p = px + i * channels;
+    unsigned char cur[4] = {p[0], p[1], p[2], channels == 4 ? p[3] : prev[3]};
+    if (std::memcmp(cur, prev, 4) == 0) {
+      if (++run == 62 || i + 1 == npx) {
+        out.push_back(static_cast<unsigned char>(0xC0 | (run - 1)));
+        run = 0;
+      }
+      continue;
+    }
+    if (run > 0) {
+      out.push_back(static_cast<unsigned char>(0xC0 | (run - 1)));
+      run = 0;
+    }
+    const int hash = (cur[0] * 3 + cur[1] * 5 + cur[2] * 7 + cur[3] * 11) % 64;
+    if (std::memcmp(index[hash], cur, 4) == 0) {
+      out.push_back(static_cast<unsigned char>(hash));
+    } else {
+      std::memcpy(index[hash], cur, 4);
+      if (cur[3] == prev[3]) {
+        const signed char vr = static_cast<signed char>(cur[0] - prev[0]);
+        const signed char vg = static_cast<signed char>(cur[1] - prev[1]);
+        const signed char vb = static_cast<signed char>(cur[2] - prev[2]);
+        const signed char vg_r = static_cast<signed char>(vr - vg);
+        const signed char vg_b = static_cast<signed char>(vb - vg);
+        if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+          out.push_back(static_cast<unsigned char>(0x40 | ((vr + 2) << 4) | ((vg + 2) << 2) | (vb + 2)));
+        } else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+          out.push_back(static_cast<unsigned char>(0x80 | (vg + 32)));
+          out.push_back(static_cast<unsigned char>(((vg_r + 8) << 4) | (vg_b + 8)));
+        } else {
+          out.insert(out.end(), {0xFE, cur[0], cur[1], cur[2]});
+        }
+      } else {
+        out.insert(out.end(), {0xFF, cur[0], cur[1], cur[2], cur[3]});
+      }
+    }
+    std::memcpy(prev, cur, 4);
+  }
+  out.insert(out.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+  return out;
+}
+
+std::vector<unsigned char> encode_rgb565_raw(const uint16_t *px, int w, int h) {
+  std::vector<unsigned char> out;
+  if (!px || w <= 0 || h <= 0) return out;
+  const size_t npx = size_t(w) * size_t(h);
+  out.reserve(kRgb565HeaderSize + npx * 2);
+  out.insert(out.end(), {'R', '5', '6', '5'});
+  put_le32(out, kRgb565Version);
+  put_le32(out, uint32_t(w));
+  put_le32(out, uint32_t(h));
+  for (size_t i = 0; i < npx; ++i) {
+    out.push_back(static_cast<unsigned char>(px[i] & 0xFF));
+    out.push_back(static_cast<unsigned char>(px[i] >> 8));
+  }
+  return out;
+}
+
+} // namespace core
@@ -1,6 +1,7 @@
 #include "core/file_utils.h"
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <unistd.h>
 #include <errno.h>
@@ -134,4 +135,90 @@ std::string get_exe_dir() {
 }
 
 
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : data_(other.data_), size_(other.size_), mapped_(other.mapped_), buf_(std::move(other.buf_)) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.mapped_ = false;
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        close();
+        data_ = other.data_;
+        size_ = other.size_;
+        mapped_ = other.mapped_;
+        buf_ = std::move(other.buf_);
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.mapped_ = false;
+    }
+    return *this;
+}
+
+bool MappedFile::open(const std::string &path) {
+    close();
+    if (path.empty()) return false;
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    const size_t len = static_cast<size_t>(st.st_size);
+
+    if (len >= kMapThreshold) {
+        void *p = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            ::close(fd); // the mapping keeps the file referenced
+            madvise(p, len, MADV_SEQUENTIAL);
+            data_ = static_cast<const unsigned char *>(p);
+            size_ = len;
+            mapped_ = true;
+            return true;
+        }
+        // fall through to pread (e.g. filesystems without mmap support)
+    }
+
+    buf_.resize(len);
+    size_t got = 0;
+    while (got < len) {
+        ssize_t n = pread(fd, buf_.data() + got, len - got, static_cast<off_t>(got));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        got += static_cast<size_t>(n);
+    }
+    ::close(fd);
+    if (got != len) {
+        buf_.clear();
+        return false;
+    }
+    data_ = buf_.data();
+    size_ = len;
+    return true;
+}
+
+void MappedFile::done_reading() {
+    if (mapped_ && data_) {
+        madvise(const_cast<unsigned char *>(data_), size_, MADV_DONTNEED);
+    }
+}
+
+void MappedFile::close() {
+    if (mapped_ && data_) {
+        done_reading();
+        munmap(const_cast<unsigned char *>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    buf_.clear();
+    buf_.shrink_to_fit();
+}
+
 } // namespace file_utils
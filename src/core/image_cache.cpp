@@ -1,23 +1,149 @@
 // src/core/image_cache.cpp
 #include "core/image_cache.h"
+#include "core/cover_formats.h"
+#include "core/file_utils.h"
+#include "core/image_loader.h"
 #include "core/logger.h"
+#include "core/pixel_convert.h"
+#include "core/thread_pool.h"
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iostream>
 
-// DO NOT define STB_IMAGE_IMPLEMENTATION here!
-// image_loader.cpp contains the single STB implementation.
-#include "stb_image.h"
-
-#if defined(__unix__) || defined(__APPLE__)
- #include <SDL/SDL.h>
-#elif defined(_WIN32)
- #include <SDL.h>
+// Native surfaces are SDL surfaces when SDL is available; without it (or with
+// SLIDERUI_NO_SDL, as headless builds set) only the ImageData accessors are functional
+#if defined(SLIDERUI_NO_SDL)
+#elif defined(_WIN32) && defined(__has_include)
+ #if __has_include(<SDL.h>)
+  #include <SDL.h>
+ #endif
+#elif defined(__has_include)
+ #if __has_include(<SDL/SDL.h>)
+  #include <SDL/SDL.h>
+ #endif
 #else
  #include <SDL/SDL.h>
 #endif
 
 using namespace core;
 
+bool core::image_to_rgb565(const ImageData &data, uint8_t *dst, int pitch, bool dither, uint32_t matte) {
+    const int w = data.width;
+    const int h = data.height;
+    if (data.rgb565.size() == static_cast<size_t>(w) * h) {
+        for (int y = 0; y < h; ++y)
+            std::memcpy(dst + static_cast<size_t>(y) * pitch, data.rgb565.data() + static_cast<size_t>(y) * w,
+                        static_cast<size_t>(w) * sizeof(uint16_t));
+        return true;
+    }
+    if (data.channels != 3 && data.channels != 4) {
+        LOG_INFO(IMAGE, "Unsupported channel count: " + std::to_string(data.channels));
+        return false;
+    }
+    if (data.format == ImageFormat::RGB565) dither = false;
+    const unsigned mr = (matte >> 16) & 0xFF, mg = (matte >> 8) & 0xFF, mb = matte & 0xFF;
+    std::vector<uint8_t> rgb(data.channels == 4 ? size_t(w) * 3 : 0);
+    for (int y = 0; y < h; ++y) {
+        const unsigned char *src = data.pixels.data() + size_t(y) * w * data.channels;
+        if (data.channels == 4) {
+            for (int x = 0; x < w; ++x, src += 4) {
+                const unsigned a = src[3];
+                rgb[x * 3 + 0] = static_cast<uint8_t>((src[0] * a + mr * (255 - a) + 127) / 255);
+                rgb[x * 3 + 1] = static_cast<uint8_t>((src[1] * a + mg * (255 - a) + 127) / 255);
+                rgb[x * 3 + 2] = static_cast<uint8_t>((src[2] * a + mb * (255 - a) + 127) / 255);
+            }
+            src = rgb.data();
+        }
+        rgb888_to_rgb565_row(src, reinterpret_cast<uint16_t*>(dst + size_t(y) * pitch), w, dither, y);
+    }
+    return true;
+}
+
+#if defined(SDL_MAJOR_VERSION)
+// RGB565 surface (no alpha) holding `data` (image_to_rgb565)
+static SDL_Surface *surface_565_from_image(const ImageData &data, bool dither, uint32_t matte) {
+    if (data.rgb565.empty() && data.channels != 3 && data.channels != 4) {
+        LOG_INFO(IMAGE, "Unsupported channel count: " + std::to_string(data.channels));
+        return nullptr;
+    }
+    SDL_Surface *surf = SDL_CreateRGBSurface(SDL_SWSURFACE, data.width, data.height, 16, 0xF800, 0x07E0, 0x001F, 0);
+    if (!surf) {
+        LOG_ERROR(IMAGE, std::string("SDL_CreateRGBSurface failed for RGB565: ") + SDL_GetError());
+        return nullptr;
+    }
+    if (SDL_MUSTLOCK(surf)) SDL_LockSurface(surf);
+    image_to_rgb565(data, static_cast<uint8_t*>(surf->pixels), surf->pitch, dither, matte);
+    if (SDL_MUSTLOCK(surf)) SDL_UnlockSurface(surf);
+    return surf;
+}
+
+// Surface holding a copy of `data`: 32-bit RGBA (RGB gets opaque alpha), or RGB565 when
+// bpp == 16 (see ImageCache::set_surface_depth)
+static SDL_Surface *surface_from_image(const ImageData &data, int bpp = 32, bool dither = true,
+                                       uint32_t matte = 0) {
+    if (bpp == 16) return surface_565_from_image(data, dither, matte);
+    const int w = data.width;
+    const int h = data.height;
+    if (data.channels == 4) {
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+        Uint32 rmask = 0xff000000;
+        Uint32 gmask = 0x00ff0000;
+        Uint32 bmask = 0x0000ff00;
+        Uint32 amask = 0x000000ff;
+#else
+        Uint32 rmask = 0x000000ff;
+        Uint32 gmask = 0x0000ff00;
+        Uint32 bmask = 0x00ff0000;
+        Uint32 amask = 0xff000000;
+#endif
+        SDL_Surface *surf = SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, 32, rmask, gmask, bmask, amask);
+        if (!surf) {
+            LOG_ERROR(IMAGE, std::string("SDL_CreateRGBSurface failed for RGBA: ") + SDL_GetError());
+            return nullptr;
+        }
+        Uint8 *dst = (Uint8*)surf->pixels;
+        const unsigned char *src = data.pixels.data();
+        size_t bytes2 = size_t(w) * size_t(h) * 4;
+        memcpy(dst, src, bytes2);
+        return surf;
+    }
+    if (data.channels == 3) {
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+        Uint32 rmask = 0xff000000;
+        Uint32 gmask = 0x00ff0000;
+        Uint32 bmask = 0x0000ff00;
+        Uint32 amask = 0x000000ff;
+#else
+        Uint32 rmask = 0x000000ff;
+        Uint32 gmask = 0x0000ff00;
+        Uint32 bmask = 0x00ff0000;
+        Uint32 amask = 0xff000000;
+#endif
+        SDL_Surface *tmp = SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, 32, rmask, gmask, bmask, amask);
+        if (!tmp) {
+            LOG_ERROR(IMAGE, std::string("SDL_CreateRGBSurface failed for RGB: ") + SDL_GetError());
+            return nullptr;
+        }
+        Uint8 *dst = (Uint8*)tmp->pixels;
+        const unsigned char *src = data.pixels.data();
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                size_t si = (size_t(y) * w + x) * 3;
+                size_t di = (size_t(y) * w + x) * 4;
+                dst[di + 0] = src[si + 0];
+                dst[di + 1] = src[si + 1];
+                dst[di + 2] = src[si + 2];
+                dst[di + 3] = 255;
+            }
+        }
+        return tmp;
+    }
+    LOG_INFO(IMAGE, "Unsupported channel count: " + std::to_string(data.channels));
+    return nullptr;
+}
+#endif
+
 ImageCache::ImageCache() : prefer_rgba_(false) {}
 
 ImageCache::~ImageCache() {
@@ -29,15 +155,102 @@ void ImageCache::set_prefer_rgba(bool v) {
     prefer_rgba_ = v;
 }
 
-bool ImageCache::preload(const std::string &path) {
+void ImageCache::set_surface_depth(int bpp, bool dither) {
     std::lock_guard<std::mutex> lock(mtx_);
-    if (cache_.find(path) != cache_.end()) return true;
-    ImageData data;
-    if (!decode_image_to_memory(path, data)) {
+    surface_bpp_ = bpp == 16 ? 16 : 32;
+    dither565_ = dither;
+}
+
+void ImageCache::set_decode_size_hint(int min_w, int min_h) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    hint_w_ = min_w;
+    hint_h_ = min_h;
+}
+
+void ImageCache::set_display_sizes(const std::vector<std::pair<int, int>> &sizes, ScaleMode mode,
+                                   uint32_t letterbox_rgb) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    display_sizes_ = sizes;
+    scale_mode_ = mode;
+    letterbox_rgb_ = letterbox_rgb;
+}
+
+std::string ImageCache::scaled_key(const std::string &path, int w, int h) {
+    return path + "@" + std::to_string(w) + "x" + std::to_string(h);
+}
+
+bool ImageCache::scale_image(const ImageData &src, int w, int h, ScaleMode mode, uint32_t letterbox_rgb,
+                             ImageData &out) {
+    if (src.pixels.empty() || w <= 0 || h <= 0) return false;
+    const unsigned char *rgb = src.pixels.data();
+    std::vector<unsigned char> stripped;
+    if (src.channels == 4) { // covers are opaque: drop alpha for the RGB resampler
+        stripped.resize(static_cast<size_t>(src.width) * src.height * 3);
+        for (size_t i = 0, j = 0; j < stripped.size(); i += 4, j += 3) std::memcpy(&stripped[j], &src.pixels[i], 3);
+        rgb = stripped.data();
+    } else if (src.channels != 3) {
         return false;
     }
-    cache_.emplace(path, std::move(data));
-    return true;
+    out.pixels = resample_rgb_scaled(rgb, src.width, src.height, w, h, mode, letterbox_rgb);
+    out.path = src.path;
+    out.width = w;
+    out.height = h;
+    out.channels = 3;
+    out.format = src.format;
+    if (w == src.width && h == src.height) out.rgb565 = src.rgb565; // pre-baked at this size
+    else out.rgb565.clear();
+    return !out.pixels.empty();
+}
+
+bool ImageCache::preload(const std::string &path) {
+    int wanted = 3, hint_w = 0, hint_h = 0;
+    ScaleMode scale = ScaleMode::STRETCH;
+    uint32_t letterbox = 0;
+    std::vector<std::pair<int, int>> sizes;
+    {
+        std::unique_lock<std::mutex> lock(mtx_);
+        // Another thread is decoding this path: wait for it instead of decoding twice
+        inflight_cv_.wait(lock, [&] { return inflight_.find(path) == inflight_.end(); });
+        if (cache_.find(path) != cache_.end()) return true;
+        inflight_.insert(path);
+        wanted = prefer_rgba_ ? 4 : 3;
+        hint_w = hint_w_;
+        hint_h = hint_h_;
+        scale = scale_mode_;
+        letterbox = letterbox_rgb_;
+        sizes = display_sizes_;
+    }
+
+    // Decode (and fit/fill to every display size) without holding mtx_ so preloads of
+    // different paths overlap
+    ImageData data;
+    bool ok = decode_image_to_memory(path, wanted, hint_w, hint_h, scale, data);
+    std::vector<std::pair<std::string, ImageData>> variants;
+    if (ok) {
+        for (const auto &sz : sizes) {
+            ImageData scaled;
+            if (scale_image(data, sz.first, sz.second, scale, letterbox, scaled))
+                variants.emplace_back(scaled_key(path, sz.first, sz.second), std::move(scaled));
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        inflight_.erase(path);
+        if (ok) cache_[path] = std::move(data);
+        for (auto &v : variants) {
+            if (surface_cache_.find(v.first) == surface_cache_.end()) scaled_[v.first] = std::move(v.second);
+        }
+    }
+    inflight_cv_.notify_all();
+    return ok;
+}
+
+size_t ImageCache::preload_many(const std::vector<std::string> &paths, unsigned max_threads) {
+    std::atomic<size_t> loaded{0};
+    ThreadPool::shared().parallel_for(paths.size(), [&](size_t i) {
+        if (preload(paths[i])) loaded.fetch_add(1, std::memory_order_relaxed);
+    }, max_threads ? max_threads : decode_concurrency());
+    return loaded.load();
 }
 
 bool ImageCache::has(const std::string &path) const {
@@ -69,44 +282,38 @@ void *ImageCache::get_surface_for_path(const std::string &path) {
     }
 
     if (data.pixels.empty()) {
-        ImageData decoded;
-        if (!decode_image_to_memory(path, decoded)) return nullptr;
+        if (!preload(path)) return nullptr;
         std::lock_guard<std::mutex> lock(mtx_);
-        cache_[path] = std::move(decoded);
         data = cache_[path];
     }
 
     if (data.pixels.empty()) return nullptr;
 
-    SDL_Surface *surf = nullptr;
-    int w = data.width;
-    int h = data.height;
     int channels = data.channels;
 
     // Decide desired channels based on prefer_rgba_ and what data has
-    int want = 3;
+    int want = 3, hint_w = 0, hint_h = 0, bpp = 32;
+    bool dither = true;
+    uint32_t matte = 0;
+    ScaleMode scale = ScaleMode::STRETCH;
     {
         std::lock_guard<std::mutex> lock(mtx_);
         want = prefer_rgba_ ? 4 : 3;
+        hint_w = hint_w_;
+        hint_h = hint_h_;
+        scale = scale_mode_;
+        bpp = surface_bpp_;
+        dither = dither565_;
+        matte = letterbox_rgb_;
     }
 
-    // If decoded data channels != want, reload with stbi to get desired channels
+    // If decoded data channels != want, decode again with the desired channel count
     if (channels != want) {
-        stbi_uc *pixels = stbi_load(path.c_str(), &w, &h, &channels, want);
-        if (!pixels) {
-            Logger::instance().info(std::string("stbi_load in get_surface_for_path failed for ") + path);
+        ImageData newd;
+        if (!decode_image_to_memory(path, want, hint_w, hint_h, scale, newd)) {
+            LOG_INFO(IMAGE, "re-decode in get_surface_for_path failed for " + path);
             return nullptr;
         }
-        channels = want;
-        // copy pixels into ImageData for future use
-        ImageData newd;
-        newd.path = path;
-        newd.width = w;
-        newd.height = h;
-        newd.channels = channels;
-        size_t bytes2 = size_t(w) * size_t(h) * size_t(channels);
-        newd.pixels.assign(pixels, pixels + bytes2);
-        stbi_image_free(pixels);
         {
             std::lock_guard<std::mutex> lock(mtx_);
             cache_[path] = std::move(newd);
@@ -114,75 +321,155 @@ void *ImageCache::get_surface_for_path(const std::string &path) {
         }
     }
 
-    if (data.channels == 4) {
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-        Uint32 rmask = 0xff000000;
-        Uint32 gmask = 0x00ff0000;
-        Uint32 bmask = 0x0000ff00;
-        Uint32 amask = 0x000000ff;
+    SDL_Surface *surf = surface_from_image(data, bpp, dither, matte);
+    if (!surf) return nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        surface_cache_[path] = surf;
+    }
+    return surf;
 #else
-        Uint32 rmask = 0x000000ff;
-        Uint32 gmask = 0x0000ff00;
-        Uint32 bmask = 0x00ff0000;
-        Uint32 amask = 0xff000000;
+    (void)path;
+    return nullptr;
 #endif
-        surf = SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, 32, rmask, gmask, bmask, amask);
-        if (!surf) {
-            Logger::instance().error(std::string("SDL_CreateRGBSurface failed for RGBA: ") + SDL_GetError());
-            return nullptr;
+}
+
+void *ImageCache::get_scaled_surface(const std::string &path, int w, int h) {
+#if defined(SDL_MAJOR_VERSION)
+    const std::string key = scaled_key(path, w, h);
+    ImageData scaled;
+    ScaleMode scale = ScaleMode::STRETCH;
+    uint32_t letterbox = 0;
+    int bpp = 32;
+    bool dither = true;
+    bool from_scaled = false;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        auto sit = surface_cache_.find(key);
+        if (sit != surface_cache_.end()) return sit->second;
+        auto it = scaled_.find(key);
+        if (it != scaled_.end()) {
+            // Taken out so no reader sees a moved-from entry; put back below if the surface fails
+            scaled = std::move(it->second);
+            scaled_.erase(it);
+            from_scaled = true;
         }
-        Uint8 *dst = (Uint8*)surf->pixels;
-        const unsigned char *src = data.pixels.data();
-        size_t bytes2 = size_t(w) * size_t(h) * 4;
-        memcpy(dst, src, bytes2);
-    } else if (data.channels == 3) {
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-        Uint32 rmask = 0xff000000;
-        Uint32 gmask = 0x00ff0000;
-        Uint32 bmask = 0x0000ff00;
-        Uint32 amask = 0x000000ff;
-#else
-        Uint32 rmask = 0x000000ff;
-        Uint32 gmask = 0x0000ff00;
-        Uint32 bmask = 0x00ff0000;
-        Uint32 amask = 0xff000000;
-#endif
-        SDL_Surface *tmp = SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, 32, rmask, gmask, bmask, amask);
-        if (!tmp) {
-            Logger::instance().error(std::string("SDL_CreateRGBSurface failed for RGB: ") + SDL_GetError());
-            return nullptr;
+        scale = scale_mode_;
+        letterbox = letterbox_rgb_;
+        bpp = surface_bpp_;
+        dither = dither565_;
+    }
+
+    if (scaled.pixels.empty()) {
+        // Size not in set_display_sizes() (or decoded before it was set): scale once now
+        if (!preload(path)) return nullptr;
+        ImageData src;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            src = cache_[path];
         }
-        Uint8 *dst = (Uint8*)tmp->pixels;
-        const unsigned char *src = data.pixels.data();
-        for (int y = 0; y < h; ++y) {
-            for (int x = 0; x < w; ++x) {
-                size_t si = (size_t(y) * w + x) * 3;
-                size_t di = (size_t(y) * w + x) * 4;
-                dst[di + 0] = src[si + 0];
-                dst[di + 1] = src[si + 1];
-                dst[di + 2] = src[si + 2];
-                dst[di + 3] = 255;
-            }
+        if (!scale_image(src, w, h, scale, letterbox, scaled)) return nullptr;
+    }
+
+    SDL_Surface *surf = surface_from_image(scaled, bpp, dither, letterbox);
+    if (!surf) {
+        if (from_scaled) {
+            std::lock_guard<std::mutex> lock(mtx_);
+            scaled_.emplace(key, std::move(scaled));
         }
-        surf = tmp;
-    } else {
-        Logger::instance().info(std::string("Unsupported channel count: ") + std::to_string(data.channels));
         return nullptr;
     }
-
-    if (!surf) return nullptr;
-
     {
         std::lock_guard<std::mutex> lock(mtx_);
-        surface_cache_[path] = surf;
+        surface_cache_[key] = surf; // the surface holds the pixels now
     }
     return surf;
 #else
-    (void)path;
+    (void)path; (void)w; (void)h;
     return nullptr;
 #endif
 }
 
+ImageData ImageCache::get_scaled_image(const std::string &path, int w, int h) {
+    const std::string key = scaled_key(path, w, h);
+    ScaleMode scale = ScaleMode::STRETCH;
+    uint32_t letterbox = 0;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        auto it = scaled_.find(key);
+        if (it != scaled_.end()) return it->second;
+        scale = scale_mode_;
+        letterbox = letterbox_rgb_;
+    }
+    if (!preload(path)) return ImageData();
+    ImageData src;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        src = cache_[path];
+    }
+    ImageData scaled;
+    if (!scale_image(src, w, h, scale, letterbox, scaled)) return ImageData();
+    return scaled;
+}
+
+uint32_t ImageCache::letterbox_rgb() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return letterbox_rgb_;
+}
+
+ImageCache::MipChain ImageCache::get_mip_chain(const std::string &path, int w, int h) {
+#if defined(SDL_MAJOR_VERSION)
+    const std::string key = scaled_key(path, w, h);
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        auto it = mips_.find(key);
+        if (it != mips_.end()) return it->second;
+    }
+    MipChain chain;
+    SDL_Surface *base = static_cast<SDL_Surface*>(get_scaled_surface(path, w, h));
+    if (!base) return chain;
+    chain.levels[0] = base;
+    chain.count = 1;
+    SDL_Surface *prev = base;
+    for (int level = 1; level < kMipLevels && (prev->w > 1 || prev->h > 1); ++level) {
+        const int lw = std::max(1, prev->w / 2), lh = std::max(1, prev->h / 2);
+        const int bpp = prev->format->BitsPerPixel;
+        SDL_Surface *s = SDL_CreateRGBSurface(SDL_SWSURFACE, lw, lh, bpp, prev->format->Rmask, prev->format->Gmask,
+                                              prev->format->Bmask, prev->format->Amask);
+        if (!s) break;
+        if (bpp == 16) {
+            downsample_2x_565(static_cast<const uint8_t*>(prev->pixels), prev->w, prev->h, prev->pitch,
+                              static_cast<uint8_t*>(s->pixels), s->pitch);
+        } else {
+            downsample_2x_32(static_cast<const uint8_t*>(prev->pixels), prev->w, prev->h, prev->pitch,
+                             static_cast<uint8_t*>(s->pixels), s->pitch);
+        }
+        chain.levels[level] = s;
+        chain.count = level + 1;
+        prev = s;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        auto ins = mips_.emplace(key, chain);
+        if (!ins.second) { // built concurrently: keep the first
+            for (int i = 1; i < chain.count; ++i) SDL_FreeSurface(static_cast<SDL_Surface*>(chain.levels[i]));
+            return ins.first->second;
+        }
+    }
+    return chain;
+#else
+    (void)path; (void)w; (void)h;
+    return MipChain();
+#endif
+}
+
+void *ImageCache::get_mip_for_size(const std::string &path, int w, int h, int dst_w, int dst_h) {
+    MipChain chain = get_mip_chain(path, w, h);
+    if (chain.count == 0) return nullptr;
+    return chain.levels[mip_level_for(w, h, dst_w, dst_h, chain.count)];
+}
+
 void ImageCache::clear() {
     std::lock_guard<std::mutex> lock(mtx_);
 #if defined(SDL_MAJOR_VERSION)
@@ -192,24 +479,45 @@ void ImageCache::clear() {
             SDL_FreeSurface(s);
         }
     }
+    for (auto &m : mips_) {
+        for (int i = 1; i < m.second.count; ++i) SDL_FreeSurface(static_cast<SDL_Surface*>(m.second.levels[i]));
+    }
 #endif
+    mips_.clear();
     surface_cache_.clear();
+    scaled_.clear();
     cache_.clear();
 }
 
-bool ImageCache::decode_image_to_memory(const std::string &path, ImageData &out) {
-    int w=0,h=0,ch=0;
-    int wanted = prefer_rgba_ ? 4 : 3;
-    unsigned char *pixels = stbi_load(path.c_str(), &w, &h, &ch, wanted);
-    if (!pixels) {
-        Logger::instance().info(std::string("stbi_load failed for ") + path);
+bool ImageCache::decode_image_to_memory(const std::string &path, int wanted, int hint_w, int hint_h,
+                                        ScaleMode scale, ImageData &out) {
+    int w=0,h=0;
+
+    file_utils::MappedFile file;
+    if (!file.open(path)) {
+        LOG_INFO(IMAGE, "cannot read " + path);
+        return false;
+    }
+
+    // Sniffed format -> registry backend; probed against platform limits before decoding,
+    // JPEGs reduced to the decode size hint when libjpeg is available
+    if (!decode_image_memory(file.data(), file.size(), wanted, hint_w, hint_h, out.pixels, w, h, path, scale)) {
+        LOG_INFO(IMAGE, "decode failed for " + path);
         return false;
     }
     out.path = path;
     out.width = w;
     out.height = h;
     out.channels = wanted;
-    out.pixels.assign(pixels, pixels + (size_t)w * (size_t)h * (size_t)wanted);
-    stbi_image_free(pixels);
+    // Pre-baked RGB565 at its own size: keep the payload so 16-bit surfaces get it unchanged
+    const auto info = probe_image_memory(file.data(), file.size());
+    out.format = info ? info->format : ImageFormat::UNKNOWN;
+    out.rgb565.clear();
+    if (out.format == ImageFormat::RGB565 && info->width == w && info->height == h) {
+        const unsigned char *src = file.data() + kRgb565HeaderSize;
+        out.rgb565.resize(static_cast<size_t>(w) * h);
+        for (size_t i = 0; i < out.rgb565.size(); ++i, src += 2)
+            out.rgb565[i] = static_cast<uint16_t>(src[0] | (src[1] << 8));
+    }
     return true;
 }
@@ -7,156 +7,1045 @@
 // Only this file should have it.
 
 #include "core/image_loader.h"
+#include "core/pixel_convert.h"
+#include "core/cover_formats.h"
+#include "core/config_manager.h"
+#include "core/file_utils.h"
+#include "core/logger.h"
+#include "core/thread_pool.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
-#include <fstream>
 #include <vector>
 #include <cstring>
 #include <algorithm>
 #include <cctype>
+#include <string>
 #include <optional>
-#include <iterator>
+#include <cmath>
+#include <atomic>
+#include <climits>
 
 #ifdef HAVE_WEBP
 #include <webp/decode.h>
 #endif
 
+#if defined(HAVE_LIBJPEG) || defined(HAVE_LIBPNG)
+#include <csetjmp>
+#endif
+
+#ifdef HAVE_LIBJPEG
+#include <cstdio>
+#include <jpeglib.h>
+#endif
+
+#ifdef HAVE_LIBPNG
+#include <png.h>
+#endif
+
 namespace core {
 
-// Helper - lowercase extension
-static std::string path_lower(const std::string &p) {
-  std::string s = p;
-  std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c){ return static_cast<char>(std::tolower(c)); });
-  return s;
+// Fixed-point precision of the resampling weights (weights of one output sum to 1 << kWeightBits).
+static constexpr int kWeightBits = 14;
+// The horizontal pass keeps this many fractional bits in its 16-bit intermediate.
+static constexpr int kMidBits = 8;
+
+// Contributors of one output sample along an axis: taps [start, start + count) of the source.
+struct ResampleTaps {
+  std::vector<int> start;
+  std::vector<int> count;
+  std::vector<uint16_t> weights; // `max_taps` entries per output sample
+  int max_taps = 1;
+};
+
+// Precompute taps for one axis. Runs once per output column/row, so doubles are fine here.
+static ResampleTaps build_taps(int src, int tgt, ResampleFilter filter) {
+  if (filter == ResampleFilter::AUTO) filter = (tgt < src) ? ResampleFilter::AREA : ResampleFilter::BILINEAR;
+  ResampleTaps t;
+  const double scale = static_cast<double>(src) / static_cast<double>(tgt);
+  if (filter == ResampleFilter::AREA && tgt < src) {
+    t.max_taps = static_cast<int>(std::ceil(scale)) + 1;
+  } else if (filter == ResampleFilter::NEAREST) {
+    t.max_taps = 1;
+  } else {
+    t.max_taps = 2;
+    if (filter == ResampleFilter::AREA) filter = ResampleFilter::BILINEAR; // area == bilinear when growing
+  }
+  t.start.resize(tgt);
+  t.count.resize(tgt);
+  t.weights.assign(static_cast<size_t>(tgt) * t.max_taps, 0);
+  const int one = 1 << kWeightBits;
+
+  for (int o = 0; o < tgt; ++o) {
+    uint16_t *w = &t.weights[static_cast<size_t>(o) * t.max_taps];
+    if (filter == ResampleFilter::NEAREST) {
+      int s = std::min(src - 1, static_cast<int>((o + 0.5) * scale));
+      t.start[o] = s;
+      t.count[o] = 1;
+      w[0] = static_cast<uint16_t>(one);
+    } else if (filter == ResampleFilter::AREA) {
+      double lo = o * scale, hi = (o + 1) * scale;
+      int s0 = static_cast<int>(std::floor(lo));
+      int s1 = std::min(src, static_cast<int>(std::ceil(hi)));
+      int n = std::min(t.max_taps, s1 - s0);
+      t.start[o] = s0;
+      t.count[o] = n;
+      int sum = 0, big = 0;
+      for (int i = 0; i < n; ++i) {
+        double cover = std::min(hi, double(s0 + i + 1)) - std::max(lo, double(s0 + i));
+        w[i] = static_cast<uint16_t>(std::lround(std::max(0.0, cover) / scale * one));
+        sum += w[i];
+        if (w[i] > w[big]) big = i;
+      }
+      w[big] = static_cast<uint16_t>(w[big] + (one - sum)); // exact normalisation
+    } else { // BILINEAR
+      double c = (o + 0.5) * scale - 0.5;
+      int s0 = static_cast<int>(std::floor(c));
+      double f = c - s0;
+      if (s0 < 0) { s0 = 0; f = 0.0; }
+      if (s0 >= src - 1) { s0 = src - 1; f = 0.0; }
+      t.start[o] = s0;
+      t.count[o] = (f > 0.0) ? 2 : 1;
+      uint16_t w1 = static_cast<uint16_t>(std::lround(f * one));
+      w[0] = static_cast<uint16_t>(one - w1);
+      w[1] = w1;
+    }
+  }
+  return t;
 }
 
-static bool ends_with(const std::string &s, const std::string &suffix) {
-  if (s.size() < suffix.size()) return false;
-  return s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+// ---------------------------------------------------------------------------
+// Fit / fill placement
+
+ScaleMode scale_mode_from_string(const std::string &name, ScaleMode fallback) {
+  std::string n(name);
+  for (auto &c : n) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  if (n == "fit") return ScaleMode::FIT;
+  if (n == "fill") return ScaleMode::FILL;
+  if (n == "stretch") return ScaleMode::STRETCH;
+  return fallback;
 }
 
-// Convert 8-bit r,g,b -> rgb565 uint16_t
-static inline uint16_t rgb_to_rgb565(unsigned char r, unsigned char g, unsigned char b) {
-  uint16_t R = static_cast<uint16_t>(r >> 3);
-  uint16_t G = static_cast<uint16_t>(g >> 2);
-  uint16_t B = static_cast<uint16_t>(b >> 3);
-  return static_cast<uint16_t>((R << 11) | (G << 5) | (B));
+ScalePlan plan_scale(int src_w, int src_h, int box_w, int box_h, ScaleMode mode) {
+  ScalePlan p{0, 0, src_w, src_h, 0, 0, box_w, box_h};
+  if (src_w <= 0 || src_h <= 0 || box_w <= 0 || box_h <= 0 || mode == ScaleMode::STRETCH) return p;
+  // Compare aspect ratios exactly: src_w / src_h vs box_w / box_h
+  const int64_t sw_bh = static_cast<int64_t>(src_w) * box_h;
+  const int64_t bw_sh = static_cast<int64_t>(box_w) * src_h;
+  if (sw_bh == bw_sh) return p;
+  auto scaled = [](int64_t a, int64_t b, int64_t c) { // round(a * b / c), at least 1
+    return static_cast<int>(std::max<int64_t>(1, (a * b + c / 2) / c));
+  };
+  const bool wider = sw_bh > bw_sh; // source is wider than the box
+  if (mode == ScaleMode::FIT) {
+    if (wider) p.dst_h = std::min(box_h, scaled(src_h, box_w, src_w));
+    else p.dst_w = std::min(box_w, scaled(src_w, box_h, src_h));
+    p.dst_x = (box_w - p.dst_w) / 2;
+    p.dst_y = (box_h - p.dst_h) / 2;
+  } else { // FILL
+    if (wider) p.crop_w = std::min(src_w, scaled(src_h, box_w, box_h));
+    else p.crop_h = std::min(src_h, scaled(src_w, box_h, box_w));
+    p.crop_x = (src_w - p.crop_w) / 2;
+    p.crop_y = (src_h - p.crop_h) / 2;
+  }
+  return p;
 }
 
-// Nearest-neighbor resample from src_rgb (src_w*src_h*3) to target size
-static std::vector<uint16_t> resample_nearest_to_rgb565(const unsigned char *src_rgb,
-                                                        int src_w, int src_h,
-                                                        int tgt_w, int tgt_h) {
-  std::vector<uint16_t> out;
-  out.resize(static_cast<size_t>(tgt_w) * static_cast<size_t>(tgt_h));
-  for (int y = 0; y < tgt_h; ++y) {
-    int sy = (src_h == 1) ? 0 : (y * src_h) / tgt_h;
-    if (sy >= src_h) sy = src_h - 1;
-    for (int x = 0; x < tgt_w; ++x) {
-      int sx = (src_w == 1) ? 0 : (x * src_w) / tgt_w;
-      if (sx >= src_w) sx = src_w - 1;
-      const unsigned char *p = src_rgb + (sy * src_w + sx) * 3;
-      unsigned char r = p[0];
-      unsigned char g = p[1];
-      unsigned char b = p[2];
-      out[static_cast<size_t>(y) * static_cast<size_t>(tgt_w) + static_cast<size_t>(x)] = rgb_to_rgb565(r, g, b);
+int mip_level_for(int base_w, int base_h, int dst_w, int dst_h, int levels) {
+  int level = 0;
+  while (level + 1 < levels) {
+    const int w = std::max(1, base_w >> (level + 1)), h = std::max(1, base_h >> (level + 1));
+    if (w < dst_w || h < dst_h) break;
+    ++level;
+  }
+  return level;
+}
+
+// ---------------------------------------------------------------------------
+// RowResampler
+
+struct RowResampler::Impl {
+  int src_w = 0, src_h = 0, tgt_w = 0, tgt_h = 0; // crop size -> dst rect size
+  int full_h = 0, crop_x = 0, crop_y = 0;         // placement (ScalePlan)
+  int dst_x = 0, dst_y = 0, dst_stride = 0;       // dst_stride in pixels
+  uint16_t *dst = nullptr;
+  unsigned char *dst_rgb = nullptr; // RGB888 output instead of RGB565
+  ResampleFilter filter = ResampleFilter::AUTO;
+  bool dither = false;
+  bool identity = false;
+  ResampleTaps tx, ty;
+  std::vector<uint8_t> row_used;     // source rows some output row reads
+  std::vector<uint16_t> ring;        // last ty.max_taps horizontally filtered rows (8.8 fixed point)
+  std::vector<uint32_t> acc;
+  std::vector<unsigned char> line;   // one output row of RGB888 before packing
+  int pushed = 0;
+  int next_out = 0;
+
+  size_t mid_stride() const { return static_cast<size_t>(tgt_w) * 3; }
+  uint16_t *ring_row(int sy) { return &ring[static_cast<size_t>(sy % ty.max_taps) * mid_stride()]; }
+  void emit_row(const unsigned char *rgb, int y) {
+    const size_t off = static_cast<size_t>(y + dst_y) * dst_stride + dst_x;
+    if (dst_rgb) std::memcpy(dst_rgb + off * 3, rgb, mid_stride());
+    else rgb888_to_rgb565_row(rgb, dst + off, tgt_w, dither, y + dst_y, dst_x);
+  }
+  void emit(int y) { emit_row(line.data(), y); }
+  void place(const ScalePlan &plan, int full_w, int full_h_, int box_w);
+  void setup();
+  void horizontal(const unsigned char *srow, uint16_t *mrow);
+  void vertical(int y);
+};
+
+void RowResampler::Impl::horizontal(const unsigned char *srow, uint16_t *mrow) {
+  const int hshift = kWeightBits - kMidBits;
+  for (int x = 0; x < tgt_w; ++x) {
+    const uint16_t *w = &tx.weights[static_cast<size_t>(x) * tx.max_taps];
+    const unsigned char *p = srow + static_cast<size_t>(tx.start[x]) * 3;
+    uint32_t r = 0, g = 0, b = 0;
+    for (int i = 0; i < tx.count[x]; ++i, p += 3) {
+      r += w[i] * p[0];
+      g += w[i] * p[1];
+      b += w[i] * p[2];
+    }
+    mrow[x * 3 + 0] = static_cast<uint16_t>((r + (1u << (hshift - 1))) >> hshift);
+    mrow[x * 3 + 1] = static_cast<uint16_t>((g + (1u << (hshift - 1))) >> hshift);
+    mrow[x * 3 + 2] = static_cast<uint16_t>((b + (1u << (hshift - 1))) >> hshift);
+  }
+}
+
+// Vertical pass + RGB565 pack. Accumulators stay below 2^32: 255<<8 * 2^14.
+void RowResampler::Impl::vertical(int y) {
+  const int vshift = kWeightBits + kMidBits;
+  const size_t n = mid_stride();
+  std::fill(acc.begin(), acc.end(), 1u << (vshift - 1)); // rounding bias
+  const uint16_t *w = &ty.weights[static_cast<size_t>(y) * ty.max_taps];
+  for (int i = 0; i < ty.count[y]; ++i) {
+    const uint16_t *mrow = ring_row(ty.start[y] + i);
+    const uint32_t wi = w[i];
+    for (size_t k = 0; k < n; ++k) acc[k] += wi * mrow[k];
+  }
+  for (size_t k = 0; k < n; ++k) {
+    line[k] = static_cast<unsigned char>(std::min<uint32_t>(255, acc[k] >> vshift));
+  }
+  emit(y);
+}
+
+void RowResampler::Impl::place(const ScalePlan &plan, int full_w, int full_h_, int box_w) {
+  src_w = plan.crop_w; src_h = plan.crop_h;
+  tgt_w = plan.dst_w; tgt_h = plan.dst_h;
+  full_h = full_h_;
+  crop_x = plan.crop_x; crop_y = plan.crop_y;
+  dst_x = plan.dst_x; dst_y = plan.dst_y;
+  dst_stride = box_w;
+  const bool valid = plan.crop_x >= 0 && plan.crop_y >= 0 && plan.crop_x + plan.crop_w <= full_w &&
+                     plan.crop_y + plan.crop_h <= full_h_ && plan.dst_x >= 0 && plan.dst_x + plan.dst_w <= box_w;
+  if (!valid) src_w = 0;
+}
+
+void RowResampler::Impl::setup() {
+  if ((!dst && !dst_rgb) || src_w <= 0 || src_h <= 0 || tgt_w <= 0 || tgt_h <= 0) {
+    pushed = full_h = std::max(0, full_h); // invalid: accept nothing
+    return;
+  }
+  identity = (src_w == tgt_w && src_h == tgt_h);
+  if (identity) return; // same size: straight row conversion
+  tx = build_taps(src_w, tgt_w, filter);
+  ty = build_taps(src_h, tgt_h, filter);
+  line.resize(mid_stride());
+  if (filter == ResampleFilter::NEAREST) return;
+  row_used.assign(static_cast<size_t>(src_h), 0);
+  for (int y = 0; y < tgt_h; ++y)
+    for (int i = 0; i < ty.count[y]; ++i) row_used[ty.start[y] + i] = 1;
+  ring.resize(mid_stride() * static_cast<size_t>(ty.max_taps));
+  acc.resize(mid_stride());
+}
+
+RowResampler::RowResampler(int src_w, int src_h, int tgt_w, int tgt_h, uint16_t *dst,
+                           ResampleFilter filter, bool dither)
+    : impl_(new Impl) {
+  Impl &m = *impl_;
+  m.place(ScalePlan{0, 0, src_w, src_h, 0, 0, tgt_w, tgt_h}, src_w, src_h, tgt_w);
+  m.dst = dst;
+  m.filter = filter;
+  m.dither = dither;
+  m.setup();
+}
+
+RowResampler::RowResampler(int src_w, int src_h, int tgt_w, int tgt_h, unsigned char *dst_rgb,
+                           ResampleFilter filter)
+    : impl_(new Impl) {
+  Impl &m = *impl_;
+  m.place(ScalePlan{0, 0, src_w, src_h, 0, 0, tgt_w, tgt_h}, src_w, src_h, tgt_w);
+  m.dst_rgb = dst_rgb;
+  m.filter = filter;
+  m.setup();
+}
+
+RowResampler::RowResampler(const ScalePlan &plan, int src_w, int src_h, int box_w, uint16_t *dst,
+                           ResampleFilter filter, bool dither)
+    : impl_(new Impl) {
+  Impl &m = *impl_;
+  m.place(plan, src_w, src_h, box_w);
+  m.dst = dst;
+  m.filter = filter;
+  m.dither = dither;
+  m.setup();
+}
+
+RowResampler::RowResampler(const ScalePlan &plan, int src_w, int src_h, int box_w, unsigned char *dst_rgb,
+                           ResampleFilter filter)
+    : impl_(new Impl) {
+  Impl &m = *impl_;
+  m.place(plan, src_w, src_h, box_w);
+  m.dst_rgb = dst_rgb;
+  m.filter = filter;
+  m.setup();
+}
+
+RowResampler::~RowResampler() = default;
+
+void RowResampler::push_row(const unsigned char *rgb) {
+  Impl &m = *impl_;
+  if (m.pushed >= m.full_h) return;
+  const int sy = m.pushed++ - m.crop_y;
+  if (sy < 0 || sy >= m.src_h) return; // outside the crop
+  rgb += static_cast<size_t>(m.crop_x) * 3;
+
+  if (m.identity) {
+    m.emit_row(rgb, sy);
+    return;
+  }
+
+  if (m.filter == ResampleFilter::NEAREST) {
+    // Single tap per axis: gather straight from the precomputed column indices.
+    while (m.next_out < m.tgt_h && m.ty.start[m.next_out] == sy) {
+      for (int x = 0; x < m.tgt_w; ++x) {
+        std::memcpy(&m.line[static_cast<size_t>(x) * 3], rgb + static_cast<size_t>(m.tx.start[x]) * 3, 3);
+      }
+      m.emit(m.next_out++);
     }
+    return;
+  }
+
+  if (m.row_used[sy]) m.horizontal(rgb, m.ring_row(sy));
+  // Output rows complete once their last tap has arrived; taps are monotonic in y and
+  // span at most ty.max_taps rows, so they are all still in the ring.
+  while (m.next_out < m.tgt_h && m.ty.start[m.next_out] + m.ty.count[m.next_out] - 1 <= sy) {
+    m.vertical(m.next_out++);
   }
+}
+
+bool RowResampler::done() const {
+  return impl_->pushed >= impl_->full_h;
+}
+
+std::vector<unsigned char> resample_rgb(const unsigned char *src_rgb, int src_w, int src_h,
+                                        int tgt_w, int tgt_h, ResampleFilter filter) {
+  std::vector<unsigned char> out;
+  if (!src_rgb || src_w <= 0 || src_h <= 0 || tgt_w <= 0 || tgt_h <= 0) return out;
+  out.resize(static_cast<size_t>(tgt_w) * static_cast<size_t>(tgt_h) * 3);
+  RowResampler rs(src_w, src_h, tgt_w, tgt_h, out.data(), filter);
+  const size_t stride = static_cast<size_t>(src_w) * 3;
+  for (int y = 0; y < src_h; ++y) rs.push_row(src_rgb + static_cast<size_t>(y) * stride);
   return out;
 }
 
-// Main API
-std::optional<Texture> decode_to_texture(const std::string &path, int target_w, int target_h) {
-  if (target_w <= 0 || target_h <= 0) return std::nullopt;
+std::vector<unsigned char> resample_rgb_scaled(const unsigned char *src_rgb, int src_w, int src_h,
+                                               int box_w, int box_h, ScaleMode mode, uint32_t fill_rgb,
+                                               ResampleFilter filter) {
+  std::vector<unsigned char> out;
+  if (!src_rgb || src_w <= 0 || src_h <= 0 || box_w <= 0 || box_h <= 0) return out;
+  out.resize(static_cast<size_t>(box_w) * static_cast<size_t>(box_h) * 3);
+  const ScalePlan plan = plan_scale(src_w, src_h, box_w, box_h, mode);
+  if (plan.dst_w != box_w || plan.dst_h != box_h) {
+    const unsigned char fill[3] = {static_cast<unsigned char>(fill_rgb >> 16),
+                                   static_cast<unsigned char>(fill_rgb >> 8),
+                                   static_cast<unsigned char>(fill_rgb)};
+    for (size_t i = 0; i < out.size(); i += 3) std::memcpy(&out[i], fill, 3);
+  }
+  RowResampler rs(plan, src_w, src_h, box_w, out.data(), filter);
+  const size_t stride = static_cast<size_t>(src_w) * 3;
+  for (int y = 0; y < src_h; ++y) rs.push_row(src_rgb + static_cast<size_t>(y) * stride);
+  return out;
+}
 
-  std::string lower = path_lower(path);
-  if (ends_with(lower, ".webp")) {
+std::vector<uint16_t> resample_rgb_to_rgb565(const unsigned char *src_rgb, int src_w, int src_h,
+                                             int tgt_w, int tgt_h, ResampleFilter filter, bool dither) {
+  std::vector<uint16_t> out;
+  if (!src_rgb || src_w <= 0 || src_h <= 0 || tgt_w <= 0 || tgt_h <= 0) return out;
+  out.resize(static_cast<size_t>(tgt_w) * static_cast<size_t>(tgt_h));
+  RowResampler rs(src_w, src_h, tgt_w, tgt_h, out.data(), filter, dither);
+  const size_t stride = static_cast<size_t>(src_w) * 3;
+  for (int y = 0; y < src_h; ++y) rs.push_row(src_rgb + static_cast<size_t>(y) * stride);
+  return out;
+}
+
+int jpeg_scale_denom(int src_w, int src_h, int min_w, int min_h) {
+  if (src_w <= 0 || src_h <= 0 || min_w <= 0 || min_h <= 0) return 1;
+  for (int denom = 8; denom > 1; denom /= 2) {
+    // libjpeg rounds scaled dimensions up
+    if ((src_w + denom - 1) / denom >= min_w && (src_h + denom - 1) / denom >= min_h) return denom;
+  }
+  return 1;
+}
+
+bool is_jpeg_data(const unsigned char *data, size_t size) {
+  return data && size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF;
+}
+
+// ---------------------------------------------------------------------------
+// Probe / limits
+
+static std::atomic<int> g_max_w{0};
+static std::atomic<int> g_max_h{0};
+
+const char *image_format_name(ImageFormat fmt) {
+  switch (fmt) {
+    case ImageFormat::PNG:  return "png";
+    case ImageFormat::JPEG: return "jpg";
+    case ImageFormat::BMP:  return "bmp";
+    case ImageFormat::GIF:  return "gif";
+    case ImageFormat::WEBP: return "webp";
+    case ImageFormat::QOI:  return "qoi";
+    case ImageFormat::RGB565: return "rgb565";
+    case ImageFormat::OTHER: return "other";
+    default: return "unknown";
+  }
+}
+
+static ImageFormat sniff_format(const unsigned char *d, size_t n) {
+  if (n >= 8 && std::memcmp(d, "\x89PNG\r\n\x1a\n", 8) == 0) return ImageFormat::PNG;
+  if (is_jpeg_data(d, n)) return ImageFormat::JPEG;
+  if (n >= 2 && d[0] == 'B' && d[1] == 'M') return ImageFormat::BMP;
+  if (n >= 4 && std::memcmp(d, "GIF8", 4) == 0) return ImageFormat::GIF;
+  if (n >= 12 && std::memcmp(d, "RIFF", 4) == 0 && std::memcmp(d + 8, "WEBP", 4) == 0) return ImageFormat::WEBP;
+  if (n >= 4 && std::memcmp(d, "qoif", 4) == 0) return ImageFormat::QOI;
+  if (n >= 4 && std::memcmp(d, "R565", 4) == 0) return ImageFormat::RGB565;
+  return ImageFormat::UNKNOWN;
+}
+
+std::optional<ImageInfo> probe_image_memory(const unsigned char *data, size_t size) {
+  if (!data || size == 0) return std::nullopt;
+  ImageInfo info;
+  info.format = sniff_format(data, size);
+  if (info.format == ImageFormat::WEBP) {
 #ifdef HAVE_WEBP
-    // Optional WebP path: read file into memory and use libwebp to decode RGB.
-    std::ifstream in(path, std::ios::binary);
-    if (!in) return std::nullopt;
-    std::vector<unsigned char> buf((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
-    if (buf.empty()) return std::nullopt;
-
-    int src_w = 0, src_h = 0;
-    if (!WebPGetInfo(buf.data(), static_cast<size_t>(buf.size()), &src_w, &src_h)) {
-      return std::nullopt;
-    }
-    uint8_t *rgb = WebPDecodeRGB(buf.data(), static_cast<size_t>(buf.size()), &src_w, &src_h);
-    if (!rgb) return std::nullopt;
-
-    // At this point rgb is src_w*src_h*3
-    Texture tex;
-    tex.width = target_w;
-    tex.height = target_h;
-    if (src_w == target_w && src_h == target_h) {
-      tex.pixels.resize(static_cast<size_t>(target_w) * static_cast<size_t>(target_h));
-      const unsigned char *p = rgb;
-      for (int y = 0; y < src_h; ++y) {
-        for (int x = 0; x < src_w; ++x) {
-          unsigned char r = p[0];
-          unsigned char g = p[1];
-          unsigned char b = p[2];
-          tex.pixels[static_cast<size_t>(y) * static_cast<size_t>(target_w) + static_cast<size_t>(x)] = rgb_to_rgb565(r, g, b);
+    if (!WebPGetInfo(data, size, &info.width, &info.height)) return std::nullopt;
+    info.channels = 3;
+    return info;
+#else
+    return std::nullopt;
+#endif
+  }
+  if (info.format == ImageFormat::QOI || info.format == ImageFormat::RGB565) {
+    CoverHeader hdr;
+    bool ok = (info.format == ImageFormat::QOI) ? parse_qoi_header(data, size, hdr)
+                                                : parse_rgb565_header(data, size, hdr);
+    if (!ok) return std::nullopt;
+    info.width = static_cast<int>(hdr.width);
+    info.height = static_cast<int>(hdr.height);
+    info.channels = hdr.channels;
+    return info;
+  }
+  if (size > static_cast<size_t>(INT32_MAX)) return std::nullopt;
+  if (!stbi_info_from_memory(data, static_cast<int>(size), &info.width, &info.height, &info.channels)) {
+    return std::nullopt;
+  }
+  if (info.format == ImageFormat::UNKNOWN) info.format = ImageFormat::OTHER; // e.g. TGA/PSD/PNM
+  return info;
+}
+
+std::optional<ImageInfo> probe_image(const std::string &path) {
+  // Mapped: only the header pages are actually read
+  file_utils::MappedFile file;
+  if (!file.open(path)) return std::nullopt;
+  return probe_image_memory(file.data(), file.size());
+}
+
+void set_image_max_dimensions(int max_w, int max_h) {
+  g_max_w.store(std::max(0, max_w), std::memory_order_relaxed);
+  g_max_h.store(std::max(0, max_h), std::memory_order_relaxed);
+}
+
+int plan_decode_scale(const ImageInfo &info, int min_w, int min_h) {
+  if (info.width <= 0 || info.height <= 0) return 0;
+  const int max_w = g_max_w.load(std::memory_order_relaxed);
+  const int max_h = g_max_h.load(std::memory_order_relaxed);
+  auto fits = [&](int denom) {
+    return (max_w <= 0 || (info.width + denom - 1) / denom <= max_w) &&
+           (max_h <= 0 || (info.height + denom - 1) / denom <= max_h);
+  };
+#ifdef HAVE_LIBJPEG
+  if (info.format == ImageFormat::JPEG) {
+    int denom = jpeg_scale_denom(info.width, info.height, min_w, min_h);
+    while (!fits(denom) && denom < 8) denom *= 2;
+    return fits(denom) ? denom : 0;
+  }
+#else
+  (void)min_w; (void)min_h;
+#endif
+  return fits(1) ? 1 : 0;
+}
+
+// ---------------------------------------------------------------------------
+// Row-streaming decoders. Each driver owns no C++ objects in the frame that calls setjmp;
+// buffers live in a caller-owned sink so a longjmp on decode errors never skips destructors.
+
+// Receives decoded rows of `channels` bytes per pixel (3 = RGB, 4 = RGBA): start() once
+// the output size is known, then row() top to bottom. A decoder that fails part way may be
+// followed by another one, so start() must reset any previous state.
+struct RowSink {
+  virtual ~RowSink() = default;
+  virtual bool start(int w, int h) = 0;
+  virtual void row(const unsigned char *px) = 0;
+  int channels = 3;
+  std::vector<unsigned char> strip; // scratch rows owned by the sink
+};
+
+// Largest aspect-preserving size within max_w x max_h (0 = unbounded axis)
+static void fit_within(int &w, int &h, int max_w, int max_h) {
+  double s = 1.0;
+  if (max_w > 0 && w > max_w) s = std::min(s, static_cast<double>(max_w) / w);
+  if (max_h > 0 && h > max_h) s = std::min(s, static_cast<double>(max_h) / h);
+  if (s >= 1.0) return;
+  w = std::max(1, std::min(max_w > 0 ? max_w : w, static_cast<int>(w * s + 0.5)));
+  h = std::max(1, std::min(max_h > 0 ? max_h : h, static_cast<int>(h * s + 0.5)));
+}
+
+// Full decoded image
+struct ImageSink : RowSink {
+  std::vector<unsigned char> &out;
+  int w = 0, h = 0, y = 0;
+  int max_w = 0, max_h = 0;        // RGB only: larger images are resampled down as rows arrive
+  std::unique_ptr<RowResampler> rs;
+  ImageSink(std::vector<unsigned char> &o, int ch) : out(o) { channels = ch; }
+  bool start(int sw, int sh) override {
+    w = sw; h = sh; y = 0;
+    fit_within(w, h, max_w, max_h);
+    out.resize(static_cast<size_t>(w) * static_cast<size_t>(h) * static_cast<size_t>(channels));
+    if (w != sw || h != sh) rs.reset(new RowResampler(sw, sh, w, h, out.data()));
+    return true;
+  }
+  void row(const unsigned char *px) override {
+    if (rs) { rs->push_row(px); return; }
+    const size_t stride = static_cast<size_t>(w) * static_cast<size_t>(channels);
+    std::memcpy(&out[static_cast<size_t>(y++) * stride], px, stride);
+  }
+};
+
+// Straight into the resampler/converter: no full-size decoded image exists
+struct TextureSink : RowSink {
+  Texture &tex;
+  ResampleFilter filter;
+  bool dither;
+  ScaleMode scale;
+  std::unique_ptr<RowResampler> rs;
+  TextureSink(Texture &t, ResampleFilter f, bool d, ScaleMode s = ScaleMode::STRETCH)
+      : tex(t), filter(f), dither(d), scale(s) {}
+  bool start(int w, int h) override {
+    tex.pixels.assign(static_cast<size_t>(tex.width) * static_cast<size_t>(tex.height), 0); // letterbox: black
+    rs.reset(new RowResampler(plan_scale(w, h, tex.width, tex.height, scale), w, h, tex.width,
+                              tex.pixels.data(), filter, dither));
+    return true;
+  }
+  void row(const unsigned char *rgb) override { rs->push_row(rgb); }
+};
+
+#ifdef HAVE_LIBJPEG
+namespace {
+struct JpegErrorMgr {
+  jpeg_error_mgr pub;
+  std::jmp_buf jump;
+};
+
+void jpeg_error_exit_longjmp(j_common_ptr cinfo) {
+  auto *err = reinterpret_cast<JpegErrorMgr *>(cinfo->err);
+  std::longjmp(err->jump, 1);
+}
+
+void jpeg_silent_output(j_common_ptr) {}
+
+// Rows per jpeg_read_scanlines call: one MCU row at full scale (max_v_samp_factor 2 * 8)
+constexpr int kJpegStripRows = 16;
+
+bool jpeg_decode_rows(const unsigned char *data, size_t size, int denom, int min_w, int min_h, RowSink *sink) {
+  jpeg_decompress_struct cinfo;
+  JpegErrorMgr jerr;
+  cinfo.err = jpeg_std_error(&jerr.pub);
+  jerr.pub.error_exit = jpeg_error_exit_longjmp;
+  jerr.pub.output_message = jpeg_silent_output;
+  if (setjmp(jerr.jump)) {
+    // corrupt or truncated data
+    jpeg_destroy_decompress(&cinfo);
+    return false;
+  }
+  jpeg_create_decompress(&cinfo);
+  jpeg_mem_src(&cinfo, const_cast<unsigned char *>(data), static_cast<unsigned long>(size));
+  if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK) {
+    jpeg_destroy_decompress(&cinfo);
+    return false;
+  }
+  cinfo.out_color_space = JCS_RGB;
+  cinfo.scale_num = 1;
+  if (denom != 1 && denom != 2 && denom != 4 && denom != 8) {
+    denom = jpeg_scale_denom(static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height), min_w, min_h);
+  }
+  cinfo.scale_denom = static_cast<unsigned int>(denom);
+  cinfo.dct_method = JDCT_ISLOW;
+  jpeg_start_decompress(&cinfo);
+  if (cinfo.output_components != 3 ||
+      !sink->start(static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height))) {
+    jpeg_destroy_decompress(&cinfo);
+    return false;
+  }
+  const size_t stride = static_cast<size_t>(cinfo.output_width) * 3;
+  sink->strip.resize(stride * kJpegStripRows);
+  JSAMPROW rows[kJpegStripRows];
+  for (int i = 0; i < kJpegStripRows; ++i) rows[i] = sink->strip.data() + static_cast<size_t>(i) * stride;
+  while (cinfo.output_scanline < cinfo.output_height) {
+    JDIMENSION n = jpeg_read_scanlines(&cinfo, rows, kJpegStripRows);
+    for (JDIMENSION i = 0; i < n; ++i) sink->row(rows[i]);
+  }
+  jpeg_finish_decompress(&cinfo);
+  jpeg_destroy_decompress(&cinfo);
+  return true;
+}
+} // namespace
+#endif
+
+#ifdef HAVE_LIBPNG
+namespace {
+struct PngMemReader {
+  const unsigned char *data;
+  size_t size;
+  size_t pos;
+};
+
+void png_read_from_memory(png_structp png, png_bytep out, png_size_t n) {
+  auto *r = static_cast<PngMemReader *>(png_get_io_ptr(png));
+  if (n > r->size - r->pos) png_error(png, "truncated");
+  std::memcpy(out, r->data + r->pos, n);
+  r->pos += n;
+}
+
+void png_silent_warning(png_structp, png_const_charp) {}
+
+// Row-by-row PNG decode (libpng sequential reader). Interlaced images need every pass
+// before any row is final, so they return false and go through stb_image instead.
+bool png_decode_rows(const unsigned char *data, size_t size, int, int, int, RowSink *sink) {
+  png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, png_silent_warning);
+  if (!png) return false;
+  png_infop info = png_create_info_struct(png);
+  if (!info) {
+    png_destroy_read_struct(&png, nullptr, nullptr);
+    return false;
+  }
+  PngMemReader reader{data, size, 0};
+  if (setjmp(png_jmpbuf(png))) {
+    png_destroy_read_struct(&png, &info, nullptr);
+    return false;
+  }
+  png_set_read_fn(png, &reader, png_read_from_memory);
+  png_read_info(png, info);
+  const png_uint_32 w = png_get_image_width(png, info);
+  const png_uint_32 h = png_get_image_height(png, info);
+  const int color = png_get_color_type(png, info);
+  if (png_get_interlace_type(png, info) != PNG_INTERLACE_NONE) {
+    png_destroy_read_struct(&png, &info, nullptr);
+    return false;
+  }
+  // Normalize to 8-bit RGB, dropping alpha like stbi_load(..., 3) does
+  png_set_expand(png);
+  png_set_strip_16(png);
+  png_set_strip_alpha(png);
+  if (color == PNG_COLOR_TYPE_GRAY || color == PNG_COLOR_TYPE_GRAY_ALPHA) png_set_gray_to_rgb(png);
+  png_read_update_info(png, info);
+  if (png_get_rowbytes(png, info) != static_cast<size_t>(w) * 3 ||
+      !sink->start(static_cast<int>(w), static_cast<int>(h))) {
+    png_destroy_read_struct(&png, &info, nullptr);
+    return false;
+  }
+  sink->strip.resize(static_cast<size_t>(w) * 3);
+  for (png_uint_32 y = 0; y < h; ++y) {
+    png_read_row(png, sink->strip.data(), nullptr);
+    sink->row(sink->strip.data());
+  }
+  png_read_end(png, nullptr);
+  png_destroy_read_struct(&png, &info, nullptr);
+  return true;
+}
+} // namespace
+#endif
+
+bool decode_jpeg_scaled(const unsigned char *data, size_t size, int min_w, int min_h,
+                        std::vector<unsigned char> &out_rgb, int &out_w, int &out_h, int denom) {
+#ifdef HAVE_LIBJPEG
+  if (!is_jpeg_data(data, size)) return false;
+  ImageSink sink(out_rgb, 3);
+  if (!jpeg_decode_rows(data, size, denom, min_w, min_h, &sink)) return false;
+  out_w = sink.w;
+  out_h = sink.h;
+  return true;
+#else
+  (void)data; (void)size; (void)min_w; (void)min_h; (void)out_rgb; (void)out_w; (void)out_h; (void)denom;
+  return false;
+#endif
+}
+
+// Whole-image decoders, replayed row by row into the sink
+static bool push_image_rows(const unsigned char *px, int w, int h, RowSink *sink) {
+  if (!sink->start(w, h)) return false;
+  const size_t stride = static_cast<size_t>(w) * static_cast<size_t>(sink->channels);
+  for (int y = 0; y < h; ++y) sink->row(px + static_cast<size_t>(y) * stride);
+  return true;
+}
+
+static bool stb_decode_rows(const unsigned char *data, size_t size, int, int, int, RowSink *sink) {
+  if (size > static_cast<size_t>(INT32_MAX)) return false;
+  int w = 0, h = 0, ch = 0;
+  unsigned char *img = stbi_load_from_memory(data, static_cast<int>(size), &w, &h, &ch, sink->channels);
+  if (!img) return false;
+  bool ok = push_image_rows(img, w, h, sink);
+  stbi_image_free(img);
+  return ok;
+}
+
+#ifdef HAVE_WEBP
+static bool webp_decode_rows(const unsigned char *data, size_t size, int, int, int, RowSink *sink) {
+  int w = 0, h = 0;
+  uint8_t *img = (sink->channels == 4) ? WebPDecodeRGBA(data, size, &w, &h) : WebPDecodeRGB(data, size, &w, &h);
+  if (!img) return false;
+  bool ok = push_image_rows(img, w, h, sink);
+  WebPFree(img);
+  return ok;
+}
+#endif
+
+// QOI: a single pass over the op stream, one row at a time
+static bool qoi_decode_rows(const unsigned char *data, size_t size, int, int, int, RowSink *sink) {
+  CoverHeader hdr;
+  if (!parse_qoi_header(data, size, hdr)) return false;
+  const int w = static_cast<int>(hdr.width), h = static_cast<int>(hdr.height), ch = sink->channels;
+  if (!sink->start(w, h)) return false;
+  sink->strip.resize(static_cast<size_t>(w) * static_cast<size_t>(ch));
+
+  unsigned char index[64][4];
+  std::memset(index, 0, sizeof(index));
+  unsigned char px[4] = {0, 0, 0, 255};
+  size_t p = kQoiHeaderSize;
+  const size_t end = size - 8; // end marker
+  int run = 0;
+  for (int y = 0; y < h; ++y) {
+    unsigned char *out = sink->strip.data();
+    for (int x = 0; x < w; ++x, out += ch) {
+      if (run > 0) {
+        --run;
+      } else {
+        if (p >= end) return false; // truncated
+        const unsigned char b1 = data[p++];
+        if (b1 == 0xFE) {
+          if (end - p < 3) return false;
+          px[0] = data[p]; px[1] = data[p + 1]; px[2] = data[p + 2];
           p += 3;
+        } else if (b1 == 0xFF) {
+          if (end - p < 4) return false;
+          std::memcpy(px, data + p, 4);
+          p += 4;
+        } else if ((b1 & 0xC0) == 0x00) {
+          std::memcpy(px, index[b1], 4);
+        } else if ((b1 & 0xC0) == 0x40) {
+          px[0] = static_cast<unsigned char>(px[0] + ((b1 >> 4) & 3) - 2);
+          px[1] = static_cast<unsigned char>(px[1] + ((b1 >> 2) & 3) - 2);
+          px[2] = static_cast<unsigned char>(px[2] + (b1 & 3) - 2);
+        } else if ((b1 & 0xC0) == 0x80) {
+          if (p >= end) return false;
+          const unsigned char b2 = data[p++];
+          const int vg = (b1 & 0x3F) - 32;
+          px[0] = static_cast<unsigned char>(px[0] + vg - 8 + ((b2 >> 4) & 0x0F));
+          px[1] = static_cast<unsigned char>(px[1] + vg);
+          px[2] = static_cast<unsigned char>(px[2] + vg - 8 + (b2 & 0x0F));
+        } else {
+          run = b1 & 0x3F;
         }
+        std::memcpy(index[(px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64], px, 4);
       }
-      WebPFree(rgb);
-      return tex;
+      std::memcpy(out, px, static_cast<size_t>(ch));
     }
+    sink->row(sink->strip.data());
+  }
+  return true;
+}
 
-    // resample
-    auto out_pixels = resample_nearest_to_rgb565(rgb, src_w, src_h, target_w, target_h);
-    WebPFree(rgb);
-    tex.pixels = std::move(out_pixels);
-    return tex;
-#else
-    // No WebP support compiled in
-    return std::nullopt;
+static inline uint16_t load_le16(const unsigned char *p) {
+  return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+// Raw RGB565: expand rows to 8 bits per channel (replicating the high bits)
+static bool rgb565_decode_rows(const unsigned char *data, size_t size, int, int, int, RowSink *sink) {
+  CoverHeader hdr;
+  if (!parse_rgb565_header(data, size, hdr)) return false;
+  const int w = static_cast<int>(hdr.width), h = static_cast<int>(hdr.height), ch = sink->channels;
+  if (!sink->start(w, h)) return false;
+  sink->strip.resize(static_cast<size_t>(w) * static_cast<size_t>(ch));
+  const unsigned char *src = data + kRgb565HeaderSize;
+  for (int y = 0; y < h; ++y) {
+    unsigned char *out = sink->strip.data();
+    for (int x = 0; x < w; ++x, src += 2, out += ch) {
+      const uint16_t v = load_le16(src);
+      const unsigned r = v >> 11, g = (v >> 5) & 0x3F, b = v & 0x1F;
+      out[0] = static_cast<unsigned char>((r << 3) | (r >> 2));
+      out[1] = static_cast<unsigned char>((g << 2) | (g >> 4));
+      out[2] = static_cast<unsigned char>((b << 3) | (b >> 2));
+      if (ch == 4) out[3] = 255;
+    }
+    sink->row(sink->strip.data());
+  }
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+// Decoder registry: backends per sniffed format, fastest first. Entries that fail (e.g.
+// libpng on interlaced files) fall through to the next one for the same format.
+
+using DecodeRowsFn = bool (*)(const unsigned char *data, size_t size, int denom, int min_w, int min_h,
+                              RowSink *sink);
+
+struct DecoderEntry {
+  ImageFormat format;
+  const char *name;
+  bool alpha;   // can produce 4-channel rows
+  bool scales;  // honours a plan_decode_scale denominator > 1
+  bool streams; // produces rows without a full-size intermediate
+  DecodeRowsFn decode;
+};
+
+static const DecoderEntry kDecoders[] = {
+#ifdef HAVE_LIBJPEG
+  {ImageFormat::JPEG, "libjpeg", false, true,  true,  jpeg_decode_rows},
+#endif
+#ifdef HAVE_LIBPNG
+  {ImageFormat::PNG,  "libpng",  false, false, true,  png_decode_rows},
 #endif
+#ifdef HAVE_WEBP
+  {ImageFormat::WEBP, "libwebp", true,  false, false, webp_decode_rows},
+#endif
+  {ImageFormat::QOI,  "qoi",     true,  false, true,  qoi_decode_rows},
+  {ImageFormat::RGB565, "rgb565", true, false, true,  rgb565_decode_rows},
+  {ImageFormat::JPEG, "stb",     true,  false, false, stb_decode_rows},
+  {ImageFormat::PNG,  "stb",     true,  false, false, stb_decode_rows},
+  {ImageFormat::BMP,  "stb",     true,  false, false, stb_decode_rows},
+  {ImageFormat::GIF,  "stb",     true,  false, false, stb_decode_rows},
+  {ImageFormat::OTHER, "stb",    true,  false, false, stb_decode_rows},
+};
+
+static std::atomic<uint32_t> g_enabled_formats{0xFFFFFFFFu};
+
+static uint32_t format_bit(ImageFormat fmt) { return 1u << static_cast<int>(fmt); }
+
+bool image_format_enabled(ImageFormat fmt) {
+  return (g_enabled_formats.load(std::memory_order_relaxed) & format_bit(fmt)) != 0;
+}
+
+void set_enabled_image_formats(const std::vector<std::string> &names) {
+  if (names.empty()) {
+    g_enabled_formats.store(0xFFFFFFFFu, std::memory_order_relaxed);
+    return;
+  }
+  static const ImageFormat kAll[] = {ImageFormat::PNG, ImageFormat::JPEG, ImageFormat::BMP,
+                                     ImageFormat::GIF, ImageFormat::WEBP, ImageFormat::QOI,
+                                     ImageFormat::RGB565, ImageFormat::OTHER};
+  uint32_t mask = 0;
+  for (std::string n : names) {
+    std::transform(n.begin(), n.end(), n.begin(), [](unsigned char c){ return static_cast<char>(std::tolower(c)); });
+    if (n == "jpeg") n = "jpg";
+    for (ImageFormat f : kAll) {
+      if (n == image_format_name(f)) mask |= format_bit(f);
+    }
   }
+  g_enabled_formats.store(mask, std::memory_order_relaxed);
+}
 
-  // Read file into memory so we can use stbi_load_from_memory
-  std::ifstream in(path, std::ios::binary);
-  if (!in) return std::nullopt;
-  std::vector<char> buf((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+void configure_image_decoding(const ConfigManager &cfg) {
+  auto dims = cfg.get<std::vector<int>>("platform.image_max_dimensions", std::vector<int>{});
+  if (dims.size() >= 2) set_image_max_dimensions(dims[0], dims[1]);
+  else set_image_max_dimensions(0, 0);
+  set_enabled_image_formats(cfg.get<std::vector<std::string>>("platform.image_formats", std::vector<std::string>{}));
+  set_decode_concurrency(static_cast<unsigned>(std::max(0, cfg.get<int>("platform.decode_threads", 0))));
+}
 
-  if (buf.empty()) return std::nullopt;
+const char *image_decoder_name(ImageFormat fmt, bool alpha) {
+  if (!image_format_enabled(fmt)) return nullptr;
+  for (const auto &d : kDecoders) {
+    if (d.format == fmt && (!alpha || d.alpha)) return d.name;
+  }
+  return nullptr;
+}
+
+// Whole-image backends (stb, libwebp, RGBA output) take images up to this many times
+// image_max_dimensions per axis: the full-size buffer is transient and the result is
+// resampled down, but it must stay bounded.
+static constexpr int kFullDecodeCap = 4;
 
-  int src_w = 0, src_h = 0, channels = 0;
-  unsigned char *img = stbi_load_from_memory(reinterpret_cast<const unsigned char*>(buf.data()),
-                                             static_cast<int>(buf.size()),
-                                             &src_w, &src_h, &channels, 3);
-  if (!img) return std::nullopt;
+// Scaled by 1/denom, the image stays within `factor` times image_max_dimensions
+static bool within_max_dimensions(const ImageInfo &info, int denom, int factor) {
+  const int max_w = g_max_w.load(std::memory_order_relaxed);
+  const int max_h = g_max_h.load(std::memory_order_relaxed);
+  return (max_w <= 0 || (info.width + denom - 1) / denom <= max_w * factor) &&
+         (max_h <= 0 || (info.height + denom - 1) / denom <= max_h * factor);
+}
 
-  // Now img is src_w x src_h with 3 channels (RGB)
+static bool within_full_decode_cap(const ImageInfo &info, int denom) {
+  return within_max_dimensions(info, denom, kFullDecodeCap);
+}
+
+// A backend that can take an image of any size: its rows go through a RowResampler
+// (RGB only), so no buffer larger than the limit or the target is allocated.
+static bool has_streaming_decoder(ImageFormat fmt, int channels) {
+  if (channels != 3 || !image_format_enabled(fmt)) return false;
+  for (const auto &d : kDecoders) {
+    if (d.format == fmt && d.streams) return true;
+  }
+  return false;
+}
+
+static bool registry_decode(const unsigned char *data, size_t size, const ImageInfo &info, int denom,
+                            bool stream_only, int min_w, int min_h, RowSink &sink, const std::string &label) {
+  if (!image_format_enabled(info.format)) {
+    LOG_DEBUG(IMAGE, label + ": format " + image_format_name(info.format) + " not in platform.image_formats");
+    return false;
+  }
+  // A denominator that only comes from the display-size hint is an optimization: backends
+  // that cannot scale still decode at full size and resample down.
+  const bool full_size_ok = within_max_dimensions(info, 1, 1);
+  for (const auto &d : kDecoders) {
+    if (d.format != info.format || (sink.channels == 4 && !d.alpha)) continue;
+    // full size would break image_max_dimensions
+    if ((denom > 1 && !d.scales && !full_size_ok) || (stream_only && !d.streams)) continue;
+    if (d.decode(data, size, denom, min_w, min_h, &sink)) return true;
+    LOG_DEBUG(IMAGE, label + ": " + d.name + " decoder failed");
+  }
+  return false;
+}
+
+// Probe + limits shared by the public entry points. Returns the decode scale, 0 to reject.
+// With FIT/FILL, min_w x min_h is the box and is turned into the full-image size whose
+// crop still covers the placed rect (so DCT scaling never drops below display size).
+// An image over image_max_dimensions is decoded and resampled down; past kFullDecodeCap
+// times the limit only streaming backends may take it (`stream_only`).
+static int check_decodable(const unsigned char *data, size_t size, int channels, int &min_w, int &min_h,
+                           const std::string &label, ImageInfo &info, bool &stream_only,
+                           ScaleMode scale = ScaleMode::STRETCH) {
+  stream_only = false;
+  auto probed = probe_image_memory(data, size);
+  if (!probed) {
+    LOG_DEBUG(IMAGE, label + ": unrecognized image");
+    return 0;
+  }
+  info = *probed;
+  if (scale != ScaleMode::STRETCH && min_w > 0 && min_h > 0) {
+    const ScalePlan plan = plan_scale(info.width, info.height, min_w, min_h, scale);
+    min_w = static_cast<int>((static_cast<int64_t>(info.width) * plan.dst_w + plan.crop_w - 1) / plan.crop_w);
+    min_h = static_cast<int>((static_cast<int64_t>(info.height) * plan.dst_h + plan.crop_h - 1) / plan.crop_h);
+  }
+  int denom = plan_decode_scale(info, min_w, min_h);
+  if (denom != 0) return denom;
+  denom = 1;
+#ifdef HAVE_LIBJPEG
+  if (info.format == ImageFormat::JPEG) denom = jpeg_scale_denom(info.width, info.height, min_w, min_h);
+#endif
+  stream_only = !within_full_decode_cap(info, denom);
+  if (stream_only && !has_streaming_decoder(info.format, channels)) {
+    LOG_ERROR(IMAGE, label + " (" + std::to_string(info.width) + "x" + std::to_string(info.height) +
+                     ") exceeds image_max_dimensions");
+    return 0;
+  }
+  return denom;
+}
+
+bool decode_image_memory(const unsigned char *data, size_t size, int channels, int min_w, int min_h,
+                         std::vector<unsigned char> &out, int &out_w, int &out_h, const std::string &label,
+                         ScaleMode scale) {
+  if (channels != 3 && channels != 4) return false;
+  ImageInfo info;
+  bool stream_only = false;
+  const int denom = check_decodable(data, size, channels, min_w, min_h, label, info, stream_only, scale);
+  if (denom == 0) return false;
+  ImageSink sink(out, channels);
+  if (channels == 3) {
+    sink.max_w = g_max_w.load(std::memory_order_relaxed);
+    sink.max_h = g_max_h.load(std::memory_order_relaxed);
+  }
+  if (!registry_decode(data, size, info, denom, stream_only, min_w, min_h, sink, label)) return false;
+  out_w = sink.w;
+  out_h = sink.h;
+  return true;
+}
+
+// Main API
+std::optional<Texture> decode_to_texture(const std::string &path, int target_w, int target_h,
+                                         ResampleFilter filter, bool dither, ScaleMode scale) {
+  if (target_w <= 0 || target_h <= 0) return std::nullopt;
+
+  // Map the file (pread for small ones) and hand the decoders a read-only span
+  file_utils::MappedFile file;
+  if (!file.open(path)) return std::nullopt;
+
+  // Probe the header first: enforce platform.image_max_dimensions before any pixel buffer exists
+  ImageInfo info;
+  int min_w = target_w, min_h = target_h;
+  bool stream_only = false;
+  const int denom = check_decodable(file.data(), file.size(), 3, min_w, min_h, path, info, stream_only, scale);
+  if (denom == 0) return std::nullopt;
+
+  // Streaming backends hand strips of rows straight to the resampler, so peak memory is
+  // about one strip plus the filter window instead of a full decoded image.
   Texture tex;
   tex.width = target_w;
   tex.height = target_h;
-  // If target equals source, fast path convert to rgb565 directly
-  if (src_w == target_w && src_h == target_h) {
+
+  if (info.format == ImageFormat::RGB565 && info.width == target_w && info.height == target_h &&
+      image_format_enabled(ImageFormat::RGB565)) {
+    // Pre-baked at display size: the payload already is the texture
     tex.pixels.resize(static_cast<size_t>(target_w) * static_cast<size_t>(target_h));
-    const unsigned char *p = img;
-    for (int y = 0; y < src_h; ++y) {
-      for (int x = 0; x < src_w; ++x) {
-        unsigned char r = p[0];
-        unsigned char g = p[1];
-        unsigned char b = p[2];
-        tex.pixels[static_cast<size_t>(y) * static_cast<size_t>(target_w) + static_cast<size_t>(x)] = rgb_to_rgb565(r, g, b);
-        p += 3;
-      }
-    }
-    stbi_image_free(img);
+    const unsigned char *src = file.data() + kRgb565HeaderSize;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    std::memcpy(tex.pixels.data(), src, tex.pixels.size() * sizeof(uint16_t));
+#else
+    for (size_t i = 0; i < tex.pixels.size(); ++i) tex.pixels[i] = load_le16(src + i * 2);
+#endif
     return tex;
   }
 
-  // Resample nearest
-  auto out_pixels = resample_nearest_to_rgb565(img, src_w, src_h, target_w, target_h);
-  tex.pixels = std::move(out_pixels);
-  stbi_image_free(img);
+  TextureSink sink(tex, filter, dither, scale);
+  if (!registry_decode(file.data(), file.size(), info, denom, stream_only, min_w, min_h, sink, path)) {
+    return std::nullopt;
+  }
   return tex;
 }
 
+// ---------------------------------------------------------------------------
+// Batch decode
+
+static std::atomic<unsigned> g_decode_threads{0};
+
+void set_decode_concurrency(unsigned threads) { g_decode_threads.store(threads, std::memory_order_relaxed); }
+
+unsigned decode_concurrency() {
+  unsigned n = g_decode_threads.load(std::memory_order_relaxed);
+  return n ? n : std::max(1u, std::thread::hardware_concurrency());
+}
+
+std::vector<std::optional<Texture>> decode_many(const std::vector<std::string> &paths, int target_w,
+                                                int target_h, ResampleFilter filter, bool dither,
+                                                unsigned max_threads, ScaleMode scale) {
+  std::vector<std::optional<Texture>> out(paths.size());
+  // Every decoder keeps its state on the stack / in its sink, so items need no locking;
+  // each one writes only its own slot.
+  ThreadPool::shared().parallel_for(
+      paths.size(),
+      [&](size_t i) { out[i] = decode_to_texture(paths[i], target_w, target_h, filter, dither, scale); },
+      max_threads ? max_threads : decode_concurrency());
+  return out;
+}
+
 } // namespace core
@@ -1,26 +1,117 @@
 #include "core/logger.h"
+#include "core/config_manager.h"
+#include "core/file_utils.h"
 
+#include <atomic>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
-#include <fstream>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
 #include <mutex>
 #include <filesystem>
+#include <thread>
 #include <vector>
 #include <cstdio>
-#include <iostream>
+#include <cerrno>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
 
 namespace fs = std::filesystem;
 
 namespace core {
 
+// Ring geometry: kRingSlots must be a power of two. Each slot holds one preformatted line.
+static constexpr size_t kRingSlots = 256;
+static constexpr size_t kSlotBytes = 256;
+static constexpr auto kFlushInterval = std::chrono::milliseconds(50);
+static constexpr auto kMaxFlushDelay = std::chrono::milliseconds(1000);
+static constexpr int kMaxIov = 64;
+static constexpr size_t kStampLen = 24;    // "YYYY-MM-DDTHH:MM:SS.mmmZ"
+static constexpr size_t kPrefixMax = 40;   // "<stamp> [ERROR] "
+
+static const char *const kLevelNames[] = {"TRACE", "DEBUG", "INFO", "ERROR"};
+
+// One record of the MPSC ring (bounded queue with per-slot sequence numbers).
+// seq == pos      -> slot free for the producer claiming position `pos`
+// seq == pos + 1  -> slot holds a published record for the consumer at `pos`
+// A "lazy" record holds only "msg\n" plus a raw steady_clock stamp; its "<ts> [LEVEL] "
+// prefix is formatted by the flusher instead of the caller.
+struct LogSlot {
+  std::atomic<size_t> seq{0};
+  int64_t stamp_ns = 0;
+  uint32_t len = 0;
+  uint8_t level = 0;
+  uint8_t lazy = 0;
+  char data[kSlotBytes - 24];
+};
+static_assert(sizeof(LogSlot) == kSlotBytes, "LogSlot layout");
+
+// Crash-safe ring file (logs/ring.bin): a header with a record cursor followed by
+// `capacity` fixed-size records. Callers reserve a record with one atomic add on the mapped
+// cursor and memcpy the line into it; the kernel keeps the MAP_SHARED pages after a crash.
+// seq == 0 marks a record being written; otherwise seq == position + 1.
+static constexpr char kRingMagic[8] = {'S', 'U', 'I', 'L', 'O', 'G', 'R', '1'};
+static constexpr const char *kRingFileName = "ring.bin";
+
+struct RingFileHeader {
+  char magic[8];
+  uint32_t record_bytes;
+  uint32_t capacity;
+  std::atomic<uint32_t> cursor;  // records ever reserved
+  uint32_t reserved[11];
+};
+static_assert(sizeof(RingFileHeader) == 64, "RingFileHeader layout");
+
+struct RingFileRecord {
+  std::atomic<uint32_t> seq;
+  uint32_t len;
+  char data[kSlotBytes - 8];
+};
+static_assert(sizeof(RingFileRecord) == kSlotBytes, "RingFileRecord layout");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "ring file needs lock-free 32-bit atomics");
+
 struct LoggerState {
+  // consumer side: everything below is guarded by io_mtx (never taken by info()/error())
   std::string dir;
   size_t max_files = 5;
   size_t buffer_threshold = 1024;
-  std::string buffer; // in-memory buffered log lines
-  std::mutex mtx;
-  bool initialized = false;
+  size_t max_file_bytes = 256 * 1024;
+  int fd = -1;            // log.0, opened O_APPEND and kept open between flushes
+  size_t file_bytes = 0;  // current size of log.0
+  std::chrono::steady_clock::time_point last_write;
+  int64_t anchor_wall_ms = 0;  // wall clock at init, for converting lazy stamps
+  int64_t anchor_mono_ns = 0;  // steady clock at init
+  std::mutex io_mtx;
+  size_t tail = 0;        // next ring position to consume
+
+  // ring file mode (mapping guarded by io_mtx; producers only read the pointer)
+  void *ring_map = nullptr;
+  size_t ring_map_bytes = 0;
+  uint32_t ring_synced_cursor = 0;
+
+  // producer side
+  std::atomic<RingFileHeader*> ring_file{nullptr};
+  std::atomic<int> ring_writers{0}; // producers inside push_ring_file_record
+  std::atomic<bool> initialized{false};
+  std::atomic<bool> lazy_timestamps{false};
+  alignas(64) std::atomic<size_t> head{0};
+  std::atomic<size_t> dropped{0};
+  LogSlot slots[kRingSlots];
+
+  // flusher thread
+  std::thread flusher;
+  std::mutex wake_mtx;
+  std::condition_variable wake_cv;
+  bool stop = false; // guarded by wake_mtx
+
+  LoggerState() {
+    for (size_t i = 0; i < kRingSlots; ++i) slots[i].seq.store(i, std::memory_order_relaxed);
+  }
 };
 
 static LoggerState &state() {
@@ -33,16 +124,369 @@ Logger& Logger::instance() {
   return inst;
 }
 
-Logger::Logger() {}
-Logger::~Logger() {
-  // attempt to flush buffered logs on destruction
+// Touch state() first so it is constructed before (and destroyed after) the Logger singleton.
+Logger::Logger() { (void)state(); }
+
+static int64_t wall_now_ms() {
+  using namespace std::chrono;
+  return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+}
+
+static int64_t mono_now_ns() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Format wall-clock milliseconds as ISO8601 into `out` (kStampLen bytes, not terminated).
+// The "YYYY-MM-DDTHH:MM:SS" part is cached per thread and only rebuilt when the second
+// changes; the milliseconds are patched in with integer math.
+static void format_iso8601_ms(int64_t wall_ms, char *out) {
+  thread_local int64_t cached_sec = -1;
+  thread_local char cached[kStampLen];
+  if (wall_ms < 0) wall_ms = 0;
+  int64_t sec = wall_ms / 1000;
+  if (sec != cached_sec) {
+    std::time_t tt = static_cast<std::time_t>(sec);
+    std::tm tm{};
+#ifdef _WIN32
+    gmtime_s(&tm, &tt);
+#else
+    gmtime_r(&tt, &tm);
+#endif
+    std::strftime(cached, sizeof(cached), "%Y-%m-%dT%H:%M:%S", &tm);
+    cached[19] = '.';
+    cached[23] = 'Z';
+    cached_sec = sec;
+  }
+  int ms = static_cast<int>(wall_ms % 1000);
+  std::memcpy(out, cached, kStampLen);
+  out[20] = static_cast<char>('0' + ms / 100);
+  out[21] = static_cast<char>('0' + (ms / 10) % 10);
+  out[22] = static_cast<char>('0' + ms % 10);
+}
+
+// "<stamp> [LEVEL] " into `out` (kPrefixMax bytes); returns length.
+static size_t format_prefix(int64_t wall_ms, int level, char *out) {
+  format_iso8601_ms(wall_ms, out);
+  size_t n = kStampLen;
+  size_t ll = std::strlen(kLevelNames[level]);
+  out[n++] = ' ';
+  out[n++] = '[';
+  std::memcpy(out + n, kLevelNames[level], ll);
+  n += ll;
+  out[n++] = ']';
+  out[n++] = ' ';
+  return n;
+}
+
+static size_t prefix_len(int level) {
+  return kStampLen + 4 + std::strlen(kLevelNames[level]);
+}
+
+// Producer: claim a slot, fill it and publish. Lock-free; drops when full.
+// Eager records are formatted as "<ts> [LEVEL] msg\n"; lazy ones as "msg\n" + raw stamp.
+static void push_record(int level, const std::string &msg) {
+  auto &st = state();
+  size_t pos = st.head.load(std::memory_order_relaxed);
+  LogSlot *slot = nullptr;
+  for (;;) {
+    slot = &st.slots[pos & (kRingSlots - 1)];
+    size_t seq = slot->seq.load(std::memory_order_acquire);
+    intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      if (st.head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+    } else if (diff < 0) {
+      // ring full: consumer has not caught up
+      st.dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    } else {
+      pos = st.head.load(std::memory_order_relaxed);
+    }
+  }
+
+  char *p = slot->data;
+  size_t n = 0;
+  slot->level = static_cast<uint8_t>(level);
+  slot->lazy = st.lazy_timestamps.load(std::memory_order_relaxed) ? 1 : 0;
+  if (slot->lazy) {
+    slot->stamp_ns = mono_now_ns();
+  } else {
+    n = format_prefix(wall_now_ms(), level, p);
+  }
+  const size_t cap = sizeof(slot->data) - 1; // keep room for '\n'
+  size_t len = msg.size();
+  if (len > cap - n) len = cap - n;
+  std::memcpy(p + n, msg.data(), len);
+  n += len;
+  p[n++] = '\n';
+  slot->len = static_cast<uint32_t>(n);
+  slot->seq.store(pos + 1, std::memory_order_release);
+}
+
+// Producer in ring file mode: reserve a record, memcpy "<ts> [LEVEL] msg\n", publish. Never drops;
+// the oldest record is overwritten once the ring wraps.
+static void push_ring_file_record(RingFileHeader *hdr, int level, const std::string &msg) {
+  auto *recs = reinterpret_cast<RingFileRecord*>(hdr + 1);
+  uint32_t pos = hdr->cursor.fetch_add(1, std::memory_order_relaxed);
+  RingFileRecord &r = recs[pos % hdr->capacity];
+  r.seq.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  size_t n = format_prefix(wall_now_ms(), level, r.data);
+  const size_t cap = sizeof(r.data) - 1;
+  size_t len = std::min(msg.size(), cap - n);
+  std::memcpy(r.data + n, msg.data(), len);
+  n += len;
+  r.data[n++] = '\n';
+  r.len = static_cast<uint32_t>(n);
+  r.seq.store(pos + 1, std::memory_order_release);
+}
+
+// Write every iovec fully, handling short writes. Returns false on error.
+static bool writev_all(int fd, struct iovec *iov, int cnt) {
+  while (cnt > 0) {
+    ssize_t w = ::writev(fd, iov, cnt);
+    if (w < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    size_t left = static_cast<size_t>(w);
+    while (cnt > 0 && left >= iov->iov_len) {
+      left -= iov->iov_len;
+      ++iov;
+      --cnt;
+    }
+    if (cnt > 0) {
+      iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+      iov->iov_len -= left;
+    }
+  }
+  return true;
+}
+
+static std::string log_path(const LoggerState &st, size_t i) {
+  return (fs::path(st.dir) / ("log." + std::to_string(i))).string();
+}
+
+// Open log.0 for appending (kept open between flushes). Caller holds io_mtx.
+static bool open_current_locked(LoggerState &st) {
+  if (st.fd >= 0) return true;
+  st.fd = ::open(log_path(st, 0).c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+  if (st.fd < 0) return false;
+  struct stat sb;
+  st.file_bytes = (fstat(st.fd, &sb) == 0) ? static_cast<size_t>(sb.st_size) : 0;
+  return true;
+}
+
+static void close_current_locked(LoggerState &st) {
+  if (st.fd >= 0) ::close(st.fd);
+  st.fd = -1;
+  st.file_bytes = 0;
+}
+
+// Shift log.i -> log.i+1 (dropping the oldest) and start a fresh log.0. Caller holds io_mtx.
+static void rotate_files_locked(LoggerState &st) {
+  close_current_locked(st);
   try {
-    rotate_and_flush();
-  } catch (...) { /* swallow */ }
+    fs::path oldest = log_path(st, st.max_files - 1);
+    if (fs::exists(oldest)) fs::remove(oldest);
+    for (size_t i = st.max_files - 1; i-- > 0; ) {
+      fs::path from = log_path(st, i);
+      if (fs::exists(from)) fs::rename(from, log_path(st, i + 1));
+    }
+  } catch (...) {
+    // best effort: keep appending to whatever log.0 is
+  }
+  open_current_locked(st);
+}
+
+// Release ring slots [tail, tail + n) back to producers. Caller holds io_mtx.
+static void release_slots_locked(LoggerState &st, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    st.slots[st.tail & (kRingSlots - 1)].seq.store(st.tail + kRingSlots, std::memory_order_release);
+    ++st.tail;
+  }
+}
+
+// Count published records and their bytes without consuming them. Caller holds io_mtx.
+static size_t pending_bytes_locked(const LoggerState &st, size_t *records) {
+  size_t bytes = 0, n = 0;
+  for (size_t pos = st.tail; n < kRingSlots; ++pos, ++n) {
+    const LogSlot &slot = st.slots[pos & (kRingSlots - 1)];
+    if (slot.seq.load(std::memory_order_acquire) != pos + 1) break;
+    bytes += slot.len + (slot.lazy ? prefix_len(slot.level) : 0);
+  }
+  if (records) *records = n;
+  return bytes;
+}
+
+// Convert a lazy record's steady_clock stamp to wall-clock milliseconds.
+static int64_t lazy_wall_ms(const LoggerState &st, int64_t stamp_ns) {
+  return st.anchor_wall_ms + (stamp_ns - st.anchor_mono_ns) / 1000000;
+}
+
+// Consumer: append every published record to log.0 with writev straight from the ring slots,
+// rotating when the file would exceed max_file_bytes. Lazy records get their prefix
+// formatted here into a side buffer. Caller holds io_mtx.
+static void drain_ring_locked(LoggerState &st) {
+  struct iovec iov[kMaxIov];
+  char prefixes[kMaxIov / 2][kPrefixMax];
+  int niov = 0;
+  size_t nrec = 0;
+  size_t batch_bytes = 0;
+  bool io_ok = open_current_locked(st);
+
+  auto write_batch = [&]() {
+    if (nrec == 0) return;
+    if (io_ok && !writev_all(st.fd, iov, niov)) io_ok = false;
+    if (io_ok) st.file_bytes += batch_bytes;
+    release_slots_locked(st, nrec);
+    niov = 0;
+    nrec = 0;
+    batch_bytes = 0;
+  };
+
+  for (;;) {
+    LogSlot &slot = st.slots[(st.tail + nrec) & (kRingSlots - 1)];
+    if (slot.seq.load(std::memory_order_acquire) != st.tail + nrec + 1) break;
+    size_t plen = slot.lazy ? prefix_len(slot.level) : 0;
+    if (io_ok && st.file_bytes + batch_bytes > 0 &&
+        st.file_bytes + batch_bytes + plen + slot.len > st.max_file_bytes) {
+      write_batch();
+      rotate_files_locked(st);
+      io_ok = st.fd >= 0;
+    }
+    if (niov + 2 > kMaxIov) write_batch();
+    if (slot.lazy) {
+      char *prefix = prefixes[niov / 2];
+      format_prefix(lazy_wall_ms(st, slot.stamp_ns), slot.level, prefix);
+      iov[niov].iov_base = prefix;
+      iov[niov].iov_len = plen;
+      ++niov;
+    }
+    iov[niov].iov_base = slot.data;
+    iov[niov].iov_len = slot.len;
+    ++niov;
+    ++nrec;
+    batch_bytes += plen + slot.len;
+  }
+  write_batch();
+
+  size_t dropped = st.dropped.exchange(0, std::memory_order_relaxed);
+  if (dropped > 0 && io_ok) {
+    char ts[kStampLen];
+    format_iso8601_ms(wall_now_ms(), ts);
+    std::string note(ts, kStampLen);
+    note += " [LOGGER] dropped " + std::to_string(dropped) + " records (ring full)\n";
+    struct iovec v{ &note[0], note.size() };
+    if (writev_all(st.fd, &v, 1)) st.file_bytes += note.size();
+  }
+  st.last_write = std::chrono::steady_clock::now();
+}
+
+// Background flusher: writes pending records once enough bytes are queued, the ring is half
+// full, or kMaxFlushDelay has passed since the last write.
+static void flusher_loop() {
+  auto &st = state();
+  std::unique_lock<std::mutex> wl(st.wake_mtx);
+  while (!st.stop) {
+    st.wake_cv.wait_for(wl, kFlushInterval);
+    if (st.stop) break;
+    wl.unlock();
+    {
+      std::lock_guard<std::mutex> g(st.io_mtx);
+      size_t records = 0;
+      size_t bytes = pending_bytes_locked(st, &records);
+      bool due = std::chrono::steady_clock::now() - st.last_write >= kMaxFlushDelay;
+      if (records > 0 && (bytes >= st.buffer_threshold || records >= kRingSlots / 2 || due)) {
+        drain_ring_locked(st);
+      }
+      // ring file mode: push dirty pages to storage so power loss keeps them too
+      if (st.ring_map && due) {
+        uint32_t cursor = static_cast<RingFileHeader*>(st.ring_map)->cursor.load(std::memory_order_relaxed);
+        if (cursor != st.ring_synced_cursor) {
+          msync(st.ring_map, st.ring_map_bytes, MS_SYNC);
+          st.ring_synced_cursor = cursor;
+          st.last_write = std::chrono::steady_clock::now();
+        }
+      }
+    }
+    wl.lock();
+  }
+}
+
+// Parse a ring file image into text lines, oldest first. Torn (seq == 0) and stale records are
+// skipped. Returns false if `buf` is not a ring file.
+static bool decode_ring_image(const unsigned char *buf, size_t size, std::string &out) {
+  auto u32 = [buf](size_t off) { uint32_t v; std::memcpy(&v, buf + off, sizeof(v)); return v; };
+  if (size < sizeof(RingFileHeader) || std::memcmp(buf, kRingMagic, sizeof(kRingMagic)) != 0) return false;
+  uint32_t record_bytes = u32(8);
+  uint32_t capacity = u32(12);
+  uint32_t cursor = u32(16);
+  if (record_bytes != sizeof(RingFileRecord) || capacity == 0 ||
+      size < sizeof(RingFileHeader) + size_t(capacity) * record_bytes) return false;
+
+  std::vector<std::pair<uint32_t, size_t>> live; // (age, record offset)
+  for (uint32_t i = 0; i < capacity; ++i) {
+    size_t off = sizeof(RingFileHeader) + size_t(i) * record_bytes;
+    uint32_t seq = u32(off);
+    uint32_t age = cursor - seq; // 0 == newest
+    if (seq == 0 || age >= capacity) continue;
+    live.emplace_back(age, off);
+  }
+  std::sort(live.begin(), live.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+  for (const auto &rec : live) {
+    uint32_t len = std::min<uint32_t>(u32(rec.second + 4), record_bytes - 8);
+    out.append(reinterpret_cast<const char*>(buf + rec.second + 8), len);
+  }
+  return true;
+}
+
+static bool decode_ring_file(const std::string &path, std::string &out) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return false;
+  struct stat sb;
+  std::vector<unsigned char> buf;
+  bool ok = fstat(fd, &sb) == 0 && sb.st_size > 0;
+  if (ok) {
+    buf.resize(static_cast<size_t>(sb.st_size));
+    ok = ::pread(fd, buf.data(), buf.size(), 0) == static_cast<ssize_t>(buf.size());
+  }
+  ::close(fd);
+  return ok && decode_ring_image(buf.data(), buf.size(), out);
+}
+
+// Append decoded text to log.0, rotating first if it would pass max_file_bytes. Caller holds io_mtx.
+static void append_text_locked(LoggerState &st, std::string &text) {
+  if (text.empty() || !open_current_locked(st)) return;
+  if (st.file_bytes > 0 && st.file_bytes + text.size() > st.max_file_bytes) {
+    rotate_files_locked(st);
+    if (st.fd < 0) return;
+  }
+  struct iovec v{ &text[0], text.size() };
+  if (writev_all(st.fd, &v, 1)) st.file_bytes += text.size();
+}
+
+// Leave ring file mode: convert what the ring holds into log.0, then unmap. Caller holds io_mtx.
+static void export_ring_file_locked(LoggerState &st) {
+  if (!st.ring_map) return;
+  // Unpublish, then wait for producers that already picked up the mapping: after this no
+  // record can land in the ring (or touch it once unmapped). Pairs with Logger::log().
+  st.ring_file.store(nullptr, std::memory_order_seq_cst);
+  while (st.ring_writers.load(std::memory_order_seq_cst) != 0) std::this_thread::yield();
+  std::string text;
+  decode_ring_image(static_cast<const unsigned char*>(st.ring_map), st.ring_map_bytes, text);
+  append_text_locked(st, text);
+  // exported: clear the ring so the next start does not recover these lines again
+  std::memset(static_cast<char*>(st.ring_map) + sizeof(RingFileHeader), 0,
+              st.ring_map_bytes - sizeof(RingFileHeader));
+  static_cast<RingFileHeader*>(st.ring_map)->cursor.store(0, std::memory_order_relaxed);
+  msync(st.ring_map, st.ring_map_bytes, MS_SYNC);
+  munmap(st.ring_map, st.ring_map_bytes);
+  st.ring_map = nullptr;
+  st.ring_map_bytes = 0;
 }
 
-bool Logger::init(const std::string &dir, size_t max_files, size_t buffer_threshold_bytes) {
-  std::lock_guard<std::mutex> g(state().mtx);
+static bool prepare_dir(const std::string &dir) {
   try {
     if (!dir.empty()) {
       fs::path p(dir);
@@ -55,133 +499,209 @@ bool Logger::init(const std::string &dir, size_t max_files, size_t buffer_thresh
   } catch (...) {
     return false;
   }
-  state().dir = dir;
-  state().max_files = (max_files < 1) ? 1 : max_files;
-  state().buffer_threshold = (buffer_threshold_bytes < 1) ? 1 : buffer_threshold_bytes;
-  state().buffer.clear();
-  state().initialized = true;
   return true;
 }
 
-// produce ISO8601 timestamp with seconds precision
-static std::string now_iso8601() {
-  using namespace std::chrono;
-  auto t = system_clock::now();
-  std::time_t tt = system_clock::to_time_t(t);
-  auto ms = duration_cast<milliseconds>(t.time_since_epoch()) % 1000;
-  std::tm tm{};
-#ifdef _WIN32
-  gmtime_s(&tm, &tt);
-#else
-  gmtime_r(&tt, &tm);
-#endif
-  std::ostringstream oss;
-  oss << std::put_time(&tm, "%Y-%m-%dT%H:%M:%S");
-  oss << '.' << std::setfill('0') << std::setw(3) << ms.count() << "Z";
-  return oss.str();
+// Common (re)initialization: flush whatever the previous mode still holds, then switch
+// directories. Caller holds io_mtx.
+static void reset_outputs_locked(LoggerState &st, const std::string &dir, size_t max_files) {
+  // reinitialization: records logged so far still go to the previous file
+  if (st.initialized.load(std::memory_order_acquire)) drain_ring_locked(st);
+  export_ring_file_locked(st);
+  close_current_locked(st);
+  st.dir = dir;
+  st.max_files = (max_files < 1) ? 1 : max_files;
+  st.last_write = std::chrono::steady_clock::now();
+  st.anchor_wall_ms = wall_now_ms();
+  st.anchor_mono_ns = mono_now_ns();
 }
 
-static void append_line_to_buffer(const std::string &level, const std::string &msg) {
+void Logger::start_flusher() {
   auto &st = state();
-  std::ostringstream oss;
-  oss << now_iso8601() << " [" << level << "] " << msg << "\n";
-  st.buffer += oss.str();
-  std::cerr << "[DEBUG] Logger: Appended to buffer. Current size: " << st.buffer.size() 
-            << ", threshold: " << st.buffer_threshold << "\n";
+  std::lock_guard<std::mutex> g(st.wake_mtx);
+  if (!st.flusher.joinable() && !st.stop) st.flusher = std::thread(flusher_loop);
 }
 
-// rotate files and write buffer to log.0, clear buffer. Must be called with lock held or will lock internally.
-void Logger::rotate_and_flush() {
-  // Acquire lock
-  std::lock_guard<std::mutex> g(state().mtx);
-  if (!state().initialized) return;
-
-  // If nothing to write, still ensure rotation invariants (optional)
-  if (state().buffer.empty()) {
-    // no buffered content; nothing to flush
-    return;
+bool Logger::init(const std::string &dir, size_t max_files, size_t buffer_threshold_bytes,
+                  size_t max_file_bytes) {
+  auto &st = state();
+  {
+    std::lock_guard<std::mutex> g(st.io_mtx);
+    if (!prepare_dir(dir)) return false;
+    reset_outputs_locked(st, dir, max_files);
+    st.buffer_threshold = (buffer_threshold_bytes < 1) ? 1 : buffer_threshold_bytes;
+    st.max_file_bytes = (max_file_bytes < 1) ? 1 : max_file_bytes;
+    st.initialized.store(true, std::memory_order_release);
+    min_level_.store(level_.load(std::memory_order_relaxed), std::memory_order_relaxed);
   }
+  start_flusher();
+  return true;
+}
 
-  try {
-    fs::path dirp(state().dir);
-    // ensure directory exists
-    if (!dirp.empty() && !fs::exists(dirp)) fs::create_directories(dirp);
-
-    std::cerr << "[DEBUG] Logger: Writing to directory: " << state().dir << "\n";
-    std::cerr << "[DEBUG] Logger: Buffer contents: " << state().buffer << "\n";
-
-    // remove oldest if exists: log.(max_files-1)
-    if (state().max_files > 0) {
-      fs::path oldest = dirp / ("log." + std::to_string(state().max_files - 1));
-      if (fs::exists(oldest)) {
-        fs::remove(oldest);
-      }
-      // shift i<-i-1 for i=max_files-1..1
-      for (size_t i = state().max_files - 1; i-- > 0; ) {
-        fs::path from = dirp / ("log." + std::to_string(i));
-        fs::path to = dirp / ("log." + std::to_string(i+1));
-        if (fs::exists(from)) {
-          // overwrite target if exists
-          if (fs::exists(to)) fs::remove(to);
-          fs::rename(from, to);
-        }
-        if (i == 0) break; // size_t underflow guard
-      }
-    }
+bool Logger::init_ring(const std::string &dir, size_t max_files, size_t ring_bytes,
+                       size_t max_file_bytes) {
+  auto &st = state();
+  {
+    std::lock_guard<std::mutex> g(st.io_mtx);
+    if (!prepare_dir(dir)) return false;
+    reset_outputs_locked(st, dir, max_files);
+    st.max_file_bytes = (max_file_bytes < 1) ? 1 : max_file_bytes;
 
-    // write buffer to log.0
-    fs::path outpath = dirp / "log.0";
-    std::ofstream ofs(outpath, std::ios::binary | std::ios::trunc);
-    if (!ofs) {
-      // writing failed; drop buffer to avoid infinite loop
-      state().buffer.clear();
-      return;
+    // recover the previous session (crash or power loss) into the text logs first
+    std::string path = (fs::path(dir) / kRingFileName).string();
+    std::string recovered;
+    if (decode_ring_file(path, recovered)) append_text_locked(st, recovered);
+    close_current_locked(st);
+
+    size_t capacity = ring_bytes > sizeof(RingFileHeader)
+                          ? (ring_bytes - sizeof(RingFileHeader)) / sizeof(RingFileRecord) : 0;
+    if (capacity < 16) capacity = 16;
+    size_t total = sizeof(RingFileHeader) + capacity * sizeof(RingFileRecord);
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) return false;
+    void *map = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(total)) == 0) {
+      map = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
     }
-    ofs << state().buffer;
-    // do not flush every write per requirement; we flush on rotation which is now
-    ofs.flush();
-    ofs.close();
-  } catch (...) {
-    // on any filesystem error, clear buffer (best effort) and return
-    state().buffer.clear();
-    return;
+    ::close(fd);
+    if (map == MAP_FAILED) return false;
+
+    std::memset(map, 0, total);
+    auto *hdr = static_cast<RingFileHeader*>(map);
+    std::memcpy(hdr->magic, kRingMagic, sizeof(kRingMagic));
+    hdr->record_bytes = sizeof(RingFileRecord);
+    hdr->capacity = static_cast<uint32_t>(capacity);
+    msync(map, total, MS_SYNC);
+    st.ring_map = map;
+    st.ring_map_bytes = total;
+    st.ring_synced_cursor = 0;
+    st.ring_file.store(hdr, std::memory_order_release);
+    st.initialized.store(true, std::memory_order_release);
+    min_level_.store(level_.load(std::memory_order_relaxed), std::memory_order_relaxed);
   }
-  // clear buffer after successful write
-  state().buffer.clear();
+  start_flusher();
+  return true;
 }
 
-void Logger::info(const std::string &msg) {
+bool Logger::decode_ring(const std::string &ring_path, const std::string &out_path) {
+  std::string text;
+  if (!decode_ring_file(ring_path, text)) return false;
+  return file_utils::atomic_write(out_path, text);
+}
+
+void Logger::rotate_and_flush() {
+  auto &st = state();
+  std::lock_guard<std::mutex> g(st.io_mtx);
+  if (!st.initialized.load(std::memory_order_acquire)) return;
+  drain_ring_locked(st);
+  if (st.ring_map) msync(st.ring_map, st.ring_map_bytes, MS_SYNC);
+}
+
+Logger::~Logger() {
+  auto &st = state();
   {
-    std::lock_guard<std::mutex> g(state().mtx);
-    if (!state().initialized) {
-      std::cerr << "[DEBUG] Logger: Not initialized, skipping message: " << msg << "\n";
-      return;
-    }
-    append_line_to_buffer("INFO", msg);
-    if (state().buffer.size() >= state().buffer_threshold) {
-      std::cerr << "[DEBUG] Logger: Buffer threshold reached, will flush\n";
-      // release lock and rotate (rotate_and_flush will lock internally)
-    } else {
-      std::cerr << "[DEBUG] Logger: Buffer below threshold, deferring flush\n";
-      return;
+    std::lock_guard<std::mutex> g(st.wake_mtx);
+    st.stop = true;
+  }
+  st.wake_cv.notify_all();
+  if (st.flusher.joinable()) st.flusher.join();
+  // attempt to flush buffered logs on destruction
+  try {
+    rotate_and_flush();
+  } catch (...) { /* swallow */ }
+  std::lock_guard<std::mutex> g(st.io_mtx);
+  try {
+    export_ring_file_locked(st);
+  } catch (...) { /* swallow */ }
+  close_current_locked(st);
+}
+
+bool Logger::init_from_config(const ConfigManager &cfg, const std::string &base_dir) {
+  set_level(level_from_string(cfg.get<std::string>("logging.level", std::string("info"))));
+
+  uint32_t mask = static_cast<uint32_t>(LogSubsystem::ALL);
+  static const struct { const char *name; LogSubsystem bit; } kSubsystems[] = {
+    {"core", LogSubsystem::CORE},     {"config", LogSubsystem::CONFIG},
+    {"image", LogSubsystem::IMAGE},   {"render", LogSubsystem::RENDER},
+    {"input", LogSubsystem::INPUT},   {"menu", LogSubsystem::MENU},
+    {"slider", LogSubsystem::SLIDER},
+  };
+  for (const auto &sub : kSubsystems) {
+    if (!cfg.get<bool>(std::string("logging.subsystems.") + sub.name, true)) {
+      mask &= ~static_cast<uint32_t>(sub.bit);
     }
   }
-  // call rotate outside inner lock (rotate_and_flush locks itself)
-  rotate_and_flush();
+  set_subsystem_mask(mask);
+  set_lazy_timestamps(cfg.get<bool>("logging.lazy_timestamps", false));
+
+  if (!cfg.get<bool>("logging.enabled", true)) {
+    min_level_.store(static_cast<int>(LogLevel::OFF), std::memory_order_relaxed);
+    return true;
+  }
+
+  std::string dir = cfg.get<std::string>("logging.dir", std::string("logs/"));
+  if (!dir.empty() && fs::path(dir).is_relative()) dir = base_dir + dir;
+  int max_files = cfg.get<int>("logging.max_files", 10);
+  int max_file_bytes = cfg.get<int>("logging.max_file_bytes", 256 * 1024);
+  if (cfg.get<bool>("logging.ring", false)) {
+    int ring_bytes = cfg.get<int>("logging.ring_bytes", 256 * 1024);
+    return init_ring(dir, max_files > 0 ? static_cast<size_t>(max_files) : 1,
+                     ring_bytes > 0 ? static_cast<size_t>(ring_bytes) : 0,
+                     max_file_bytes > 0 ? static_cast<size_t>(max_file_bytes) : 1);
+  }
+  return init(dir, max_files > 0 ? static_cast<size_t>(max_files) : 1, 1024,
+              max_file_bytes > 0 ? static_cast<size_t>(max_file_bytes) : 1);
 }
 
-void Logger::error(const std::string &msg) {
-  {
-    std::lock_guard<std::mutex> g(state().mtx);
-    if (!state().initialized) return;
-    append_line_to_buffer("ERROR", msg);
-    if (state().buffer.size() >= state().buffer_threshold) {
-      // fall through to rotate after unlocking
-    } else {
+void Logger::set_level(LogLevel level) {
+  level_.store(static_cast<int>(level), std::memory_order_relaxed);
+  if (state().initialized.load(std::memory_order_acquire)) {
+    min_level_.store(static_cast<int>(level), std::memory_order_relaxed);
+  }
+}
+
+void Logger::set_lazy_timestamps(bool lazy) {
+  state().lazy_timestamps.store(lazy, std::memory_order_relaxed);
+}
+
+void Logger::set_subsystem_mask(uint32_t mask) {
+  subsystem_mask_.store(mask, std::memory_order_relaxed);
+}
+
+LogLevel Logger::level_from_string(const std::string &name, LogLevel fallback) {
+  if (name == "trace") return LogLevel::TRACE;
+  if (name == "debug") return LogLevel::DEBUG;
+  if (name == "info") return LogLevel::INFO;
+  if (name == "error") return LogLevel::ERROR;
+  if (name == "off") return LogLevel::OFF;
+  return fallback;
+}
+
+void Logger::log(LogLevel level, const std::string &msg) {
+  if (static_cast<int>(level) < min_level_.load(std::memory_order_relaxed)) return;
+  int idx = static_cast<int>(level);
+  if (idx < 0 || idx > 3) return;
+  auto &st = state();
+  if (st.ring_file.load(std::memory_order_relaxed)) {
+    // Announce the write before re-checking the mapping, so export_ring_file_locked either
+    // sees us and waits, or we see it unpublished and fall back to the record ring.
+    st.ring_writers.fetch_add(1, std::memory_order_seq_cst);
+    if (RingFileHeader *hdr = st.ring_file.load(std::memory_order_seq_cst)) {
+      push_ring_file_record(hdr, idx, msg);
+      st.ring_writers.fetch_sub(1, std::memory_order_release);
       return;
     }
+    st.ring_writers.fetch_sub(1, std::memory_order_release);
   }
-  rotate_and_flush();
+  push_record(idx, msg);
+}
+
+void Logger::info(const std::string &msg) {
+  log(LogLevel::INFO, msg);
+}
+
+void Logger::error(const std::string &msg) {
+  log(LogLevel::ERROR, msg);
 }
 
 } // namespace core
@@ -0,0 +1,802 @@
+// src/core/pixel_convert.cpp
+//
+// RGB888 -> RGB565 row conversion with optional 4x4 ordered dithering, the 2x2 box
+// downsamplers used for cover mip chains, the fixed-point scaled blit, and the alpha
+// blending kernels behind translucent UI elements.
+// One vector kernel per ISA (NEON / SSE2) plus the scalar reference; they must stay
+// bit-identical, test_pixel_convert checks that.
+
+#include "core/pixel_convert.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SLIDERUI_PIXEL_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SLIDERUI_PIXEL_SSE2 1
+#endif
+
+namespace core {
+
+// 4x4 Bayer matrix (0..15)
+static const uint8_t kBayer4[4][4] = {
+  { 0,  8,  2, 10},
+  {12,  4, 14,  6},
+  { 3, 11,  1,  9},
+  {15,  7, 13,  5},
+};
+
+// Per-channel threshold: 5-bit channels lose 3 bits (step 8), 6-bit green loses 2 (step 4).
+static inline uint8_t dither5(int row, int x) { return static_cast<uint8_t>(kBayer4[row & 3][x & 3] >> 1); }
+static inline uint8_t dither6(int row, int x) { return static_cast<uint8_t>(kBayer4[row & 3][x & 3] >> 2); }
+
+static inline uint8_t add_sat(uint8_t c, uint8_t d) {
+  unsigned v = static_cast<unsigned>(c) + d;
+  return static_cast<uint8_t>(v > 255 ? 255 : v);
+}
+
+static inline uint16_t pack565(uint8_t r, uint8_t g, uint8_t b) {
+  return static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+void rgb888_to_rgb565_row_scalar(const uint8_t *src, uint16_t *dst, int count, bool dither,
+                                 int row, int x0) {
+  if (!dither) {
+    for (int i = 0; i < count; ++i, src += 3) dst[i] = pack565(src[0], src[1], src[2]);
+    return;
+  }
+  for (int i = 0; i < count; ++i, src += 3) {
+    const int x = x0 + i;
+    const uint8_t d5 = dither5(row, x), d6 = dither6(row, x);
+    dst[i] = pack565(add_sat(src[0], d5), add_sat(src[1], d6), add_sat(src[2], d5));
+  }
+}
+
+#if defined(SLIDERUI_PIXEL_NEON)
+
+void rgb888_to_rgb565_row(const uint8_t *src, uint16_t *dst, int count, bool dither, int row, int x0) {
+  int i = 0;
+  // Dither thresholds for 8 consecutive columns starting at x0 (pattern repeats every 4).
+  uint8_t d5[8] = {0}, d6[8] = {0};
+  if (dither) {
+    for (int k = 0; k < 8; ++k) { d5[k] = dither5(row, x0 + k); d6[k] = dither6(row, x0 + k); }
+  }
+  const uint8x8_t vd5 = vld1_u8(d5), vd6 = vld1_u8(d6);
+  for (; i + 8 <= count; i += 8) {
+    uint8x8x3_t px = vld3_u8(src + static_cast<size_t>(i) * 3);
+    uint8x8_t r = vqadd_u8(px.val[0], vd5);
+    uint8x8_t g = vqadd_u8(px.val[1], vd6);
+    uint8x8_t b = vqadd_u8(px.val[2], vd5);
+    uint16x8_t out = vshll_n_u8(r, 8);
+    out = vsriq_n_u16(out, vshll_n_u8(g, 8), 5);
+    out = vsriq_n_u16(out, vshll_n_u8(b, 8), 11);
+    vst1q_u16(dst + i, out);
+  }
+  rgb888_to_rgb565_row_scalar(src + static_cast<size_t>(i) * 3, dst + i, count - i, dither, row, x0 + i);
+}
+
+#elif defined(SLIDERUI_PIXEL_SSE2)
+
+// Four pixels as 32-bit lanes 0x00BBGGRR from one 16-byte load, so the caller must leave
+// 4 readable bytes after the 4th pixel.
+static inline __m128i load4_rgb(const uint8_t *p) {
+  const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  const __m128i ab = _mm_unpacklo_epi32(v, _mm_srli_si128(v, 3));
+  const __m128i cd = _mm_unpacklo_epi32(_mm_srli_si128(v, 6), _mm_srli_si128(v, 9));
+  return _mm_and_si128(_mm_unpacklo_epi64(ab, cd), _mm_set1_epi32(0x00FFFFFF));
+}
+
+static inline __m128i pack4_565(__m128i v) {
+  const __m128i r = _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x0000F8)), 8);
+  const __m128i g = _mm_srli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x00FC00)), 5);
+  const __m128i b = _mm_srli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xF80000)), 19);
+  // bias into signed range so _mm_packs_epi32 doesn't saturate, undone after packing
+  return _mm_sub_epi32(_mm_or_si128(_mm_or_si128(r, g), b), _mm_set1_epi32(0x8000));
+}
+
+void rgb888_to_rgb565_row(const uint8_t *src, uint16_t *dst, int count, bool dither, int row, int x0) {
+  int i = 0;
+  // Dither thresholds for 4 consecutive columns in 0x00BBGGRR lane layout.
+  __m128i vd = _mm_setzero_si128();
+  if (dither) {
+    uint32_t lanes[4];
+    for (int k = 0; k < 4; ++k) {
+      const uint32_t d5 = dither5(row, x0 + k), d6 = dither6(row, x0 + k);
+      lanes[k] = d5 | (d6 << 8) | (d5 << 16);
+    }
+    vd = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes));
+  }
+  const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+  // `i + 10 <= count`: the second 16-byte load ends 4 bytes past pixel i+7.
+  for (; i + 10 <= count; i += 8) {
+    const uint8_t *p = src + static_cast<size_t>(i) * 3;
+    __m128i lo = _mm_adds_epu8(load4_rgb(p), vd);
+    __m128i hi = _mm_adds_epu8(load4_rgb(p + 12), vd);
+    __m128i out = _mm_xor_si128(_mm_packs_epi32(pack4_565(lo), pack4_565(hi)), bias);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), out);
+  }
+  rgb888_to_rgb565_row_scalar(src + static_cast<size_t>(i) * 3, dst + i, count - i, dither, row, x0 + i);
+}
+
+#else
+
+void rgb888_to_rgb565_row(const uint8_t *src, uint16_t *dst, int count, bool dither, int row, int x0) {
+  rgb888_to_rgb565_row_scalar(src, dst, count, dither, row, x0);
+}
+
+#endif
+
+// ---------------------------------------------------------------------------
+// 2x2 box downsample (32 bpp)
+
+// One destination row from source rows r0/r1; `step` is the byte offset of the right-hand
+// pixel of each pair (4, or 0 for a 1-pixel wide source).
+static void down_row_scalar(const uint8_t *r0, const uint8_t *r1, uint8_t *dst, int dst_w, int step) {
+  for (int x = 0; x < dst_w; ++x, r0 += 8, r1 += 8, dst += 4) {
+    for (int c = 0; c < 4; ++c) {
+      dst[c] = static_cast<uint8_t>((r0[c] + r0[step + c] + r1[c] + r1[step + c] + 2) >> 2);
+    }
+  }
+}
+
+#if defined(SLIDERUI_PIXEL_NEON)
+
+// 4 destination pixels per iteration (8 source pixels per row)
+static int down_row_simd(const uint8_t *r0, const uint8_t *r1, uint8_t *dst, int dst_w) {
+  int x = 0;
+  for (; x + 4 <= dst_w; x += 4, r0 += 32, r1 += 32, dst += 16) {
+    for (int half = 0; half < 2; ++half) {
+      const uint8x16_t a = vld1q_u8(r0 + half * 16), b = vld1q_u8(r1 + half * 16);
+      const uint16x8_t s01 = vaddl_u8(vget_low_u8(a), vget_low_u8(b));   // px0 | px1 column sums
+      const uint16x8_t s23 = vaddl_u8(vget_high_u8(a), vget_high_u8(b)); // px2 | px3
+      const uint16x8_t sum = vcombine_u16(vadd_u16(vget_low_u16(s01), vget_high_u16(s01)),
+                                          vadd_u16(vget_low_u16(s23), vget_high_u16(s23)));
+      vst1_u8(dst + half * 8, vrshrn_n_u16(sum, 2)); // (sum + 2) >> 2
+    }
+  }
+  return x;
+}
+
+#elif defined(SLIDERUI_PIXEL_SSE2)
+
+// Two 4-pixel loads (one per source row) -> 2 destination pixels as 16-bit sums
+static inline __m128i box4_sums(const uint8_t *r0, const uint8_t *r1) {
+  const __m128i z = _mm_setzero_si128();
+  const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(r0));
+  const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(r1));
+  const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, z), _mm_unpacklo_epi8(b, z)); // px0 | px1
+  const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, z), _mm_unpackhi_epi8(b, z)); // px2 | px3
+  return _mm_unpacklo_epi64(_mm_add_epi16(lo, _mm_srli_si128(lo, 8)), _mm_add_epi16(hi, _mm_srli_si128(hi, 8)));
+}
+
+// 4 destination pixels per iteration (8 source pixels per row)
+static int down_row_simd(const uint8_t *r0, const uint8_t *r1, uint8_t *dst, int dst_w) {
+  const __m128i two = _mm_set1_epi16(2);
+  int x = 0;
+  for (; x + 4 <= dst_w; x += 4, r0 += 32, r1 += 32, dst += 16) {
+    const __m128i s01 = _mm_srli_epi16(_mm_add_epi16(box4_sums(r0, r1), two), 2);
+    const __m128i s23 = _mm_srli_epi16(_mm_add_epi16(box4_sums(r0 + 16, r1 + 16), two), 2);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(s01, s23));
+  }
+  return x;
+}
+
+#else
+
+static int down_row_simd(const uint8_t *, const uint8_t *, uint8_t *, int) { return 0; }
+
+#endif
+
+template <bool kSimd>
+static void downsample_2x_32_impl(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst,
+                                  int dst_pitch) {
+  if (!src || !dst || src_w <= 0 || src_h <= 0) return;
+  const int dst_w = src_w > 1 ? src_w / 2 : 1;
+  const int dst_h = src_h > 1 ? src_h / 2 : 1;
+  const int step = src_w > 1 ? 4 : 0;
+  for (int y = 0; y < dst_h; ++y) {
+    const uint8_t *r0 = src + static_cast<size_t>(src_h > 1 ? 2 * y : 0) * src_pitch;
+    const uint8_t *r1 = src_h > 1 ? r0 + src_pitch : r0;
+    uint8_t *out = dst + static_cast<size_t>(y) * dst_pitch;
+    int x = (kSimd && step) ? down_row_simd(r0, r1, out, dst_w) : 0;
+    down_row_scalar(r0 + static_cast<size_t>(x) * 8, r1 + static_cast<size_t>(x) * 8, out + x * 4, dst_w - x, step);
+  }
+}
+
+void downsample_2x_32(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst, int dst_pitch) {
+  downsample_2x_32_impl<true>(src, src_w, src_h, src_pitch, dst, dst_pitch);
+}
+
+void downsample_2x_32_scalar(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst,
+                             int dst_pitch) {
+  downsample_2x_32_impl<false>(src, src_w, src_h, src_pitch, dst, dst_pitch);
+}
+
+// RGB565 spread over a 32-bit word (green moved to the high half): every channel has 5
+// free bits above it, so sums of up to 32 pixels, or one multiply by a 5-bit weight,
+// work on all three channels at once.
+static constexpr uint32_t kMask565 = 0x07E0F81Fu;
+static inline uint32_t expand565(uint16_t p) { return (p | (static_cast<uint32_t>(p) << 16)) & kMask565; }
+static inline uint16_t pack565x(uint32_t v) { return static_cast<uint16_t>(v | (v >> 16)); }
+
+void downsample_2x_565(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst, int dst_pitch) {
+  if (!src || !dst || src_w <= 0 || src_h <= 0) return;
+  const uint32_t round2 = 0x00401002u; // 2 in each channel's lowest bit position
+  const int dst_w = src_w > 1 ? src_w / 2 : 1;
+  const int dst_h = src_h > 1 ? src_h / 2 : 1;
+  const int step = src_w > 1 ? 1 : 0;
+  for (int y = 0; y < dst_h; ++y) {
+    const uint16_t *r0 = reinterpret_cast<const uint16_t *>(src + static_cast<size_t>(src_h > 1 ? 2 * y : 0) * src_pitch);
+    const uint16_t *r1 = src_h > 1 ? reinterpret_cast<const uint16_t *>(reinterpret_cast<const uint8_t *>(r0) + src_pitch) : r0;
+    uint16_t *out = reinterpret_cast<uint16_t *>(dst + static_cast<size_t>(y) * dst_pitch);
+    for (int x = 0; x < dst_w; ++x, r0 += 2, r1 += 2) {
+      const uint32_t sum = expand565(r0[0]) + expand565(r0[step]) + expand565(r1[0]) + expand565(r1[step]);
+      out[x] = pack565x(((sum + round2) >> 2) & kMask565);
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Scaled blit
+
+namespace {
+
+// Source index and bilinear weight (0..256, weight of idx1) for each visible destination
+// pixel of one axis.
+struct AxisMap {
+  std::vector<int> idx0, idx1;
+  std::vector<uint16_t> frac;
+};
+
+// Destination pixels [from, to) of an axis scaled from src_n to dst_n pixels. The source
+// position of pixel i is (i + 0.5) * src_n / dst_n, stepped in 16.16 fixed point; bilinear
+// samples are taken half a pixel earlier so weights are relative to pixel centres.
+void map_axis(int src_n, int dst_n, int from, int to, bool bilinear, AxisMap &m) {
+  const int n = to - from;
+  m.idx0.resize(n);
+  m.idx1.resize(n);
+  m.frac.resize(n);
+  const int64_t step = (static_cast<int64_t>(src_n) << 16) / dst_n;
+  const int64_t max_pos = static_cast<int64_t>(src_n - 1) << 16;
+  int64_t pos = from * step + step / 2 - (bilinear ? 0x8000 : 0);
+  for (int i = 0; i < n; ++i, pos += step) {
+    const int64_t p = std::min(max_pos, std::max<int64_t>(0, pos));
+    m.idx0[i] = static_cast<int>(p >> 16);
+    m.idx1[i] = std::min(m.idx0[i] + 1, src_n - 1);
+    m.frac[i] = bilinear ? static_cast<uint16_t>((p & 0xFFFF) >> 8) : 0;
+  }
+}
+
+// Visible part of `to`: intersection with `clip`. False when nothing is drawn.
+bool visible_rect(const BlitRect &to, const BlitRect &clip, BlitRect &vis) {
+  const int x0 = std::max(to.x, clip.x), y0 = std::max(to.y, clip.y);
+  const int x1 = std::min(to.x + to.w, clip.x + clip.w), y1 = std::min(to.y + to.h, clip.y + clip.h);
+  if (x1 <= x0 || y1 <= y0) return false;
+  vis.x = x0;
+  vis.y = y0;
+  vis.w = x1 - x0;
+  vis.h = y1 - y0;
+  return true;
+}
+
+template <typename Pixel>
+void blit_nearest(const uint8_t *src, int src_w, int src_pitch, uint8_t *dst, int dst_pitch, const BlitRect &to,
+                  const BlitRect &vis, const AxisMap &xm, const AxisMap &ym) {
+  const int n = vis.w;
+  const Pixel *prev_src = nullptr;
+  const uint8_t *prev_dst = nullptr;
+  for (int y = 0; y < vis.h; ++y) {
+    const Pixel *s = reinterpret_cast<const Pixel *>(src + static_cast<size_t>(ym.idx0[y]) * src_pitch);
+    uint8_t *row = dst + static_cast<size_t>(vis.y + y) * dst_pitch + static_cast<size_t>(vis.x) * sizeof(Pixel);
+    if (s == prev_src) { // upscaled: same source row as the line above
+      std::memcpy(row, prev_dst, static_cast<size_t>(n) * sizeof(Pixel));
+    } else if (src_w == to.w) {
+      std::memcpy(row, s + (vis.x - to.x), static_cast<size_t>(n) * sizeof(Pixel));
+    } else {
+      Pixel *d = reinterpret_cast<Pixel *>(row);
+      for (int x = 0; x < n; ++x) d[x] = s[xm.idx0[x]];
+    }
+    prev_src = s;
+    prev_dst = row;
+  }
+}
+
+// Bilinear, 32 bpp: vertical pass into 16-bit lanes, then horizontal pass
+void vert_scalar(const uint8_t *r0, const uint8_t *r1, uint16_t *tmp, int bytes, unsigned fy) {
+  for (int k = 0; k < bytes; ++k) tmp[k] = static_cast<uint16_t>((r0[k] * (256 - fy) + r1[k] * fy + 128) >> 8);
+}
+
+void horz_scalar(const uint16_t *tmp, const int *off0, const int *off1, const uint16_t *fx4, uint8_t *d, int n) {
+  for (int x = 0; x < n; ++x, d += 4) {
+    const uint16_t *a = tmp + off0[x] * 4, *b = tmp + off1[x] * 4;
+    const unsigned f = fx4[x * 4];
+    for (int c = 0; c < 4; ++c) d[c] = static_cast<uint8_t>((a[c] * (256 - f) + b[c] * f + 128) >> 8);
+  }
+}
+
+#if defined(SLIDERUI_PIXEL_NEON)
+
+int vert_simd(const uint8_t *r0, const uint8_t *r1, uint16_t *tmp, int bytes, unsigned fy) {
+  const uint16_t w1 = static_cast<uint16_t>(fy), w0 = static_cast<uint16_t>(256 - fy);
+  int k = 0;
+  for (; k + 8 <= bytes; k += 8) {
+    const uint16x8_t acc = vmlaq_n_u16(vmulq_n_u16(vmovl_u8(vld1_u8(r0 + k)), w0), vmovl_u8(vld1_u8(r1 + k)), w1);
+    vst1q_u16(tmp + k, vrshrq_n_u16(acc, 8)); // (acc + 128) >> 8
+  }
+  return k;
+}
+
+// 2 destination pixels per iteration
+int horz_simd(const uint16_t *tmp, const int *off0, const int *off1, const uint16_t *fx4, uint8_t *d, int n) {
+  const uint16x8_t full = vdupq_n_u16(256);
+  int x = 0;
+  for (; x + 2 <= n; x += 2) {
+    const uint16x8_t a = vcombine_u16(vld1_u16(tmp + off0[x] * 4), vld1_u16(tmp + off0[x + 1] * 4));
+    const uint16x8_t b = vcombine_u16(vld1_u16(tmp + off1[x] * 4), vld1_u16(tmp + off1[x + 1] * 4));
+    const uint16x8_t w1 = vld1q_u16(fx4 + x * 4);
+    const uint16x8_t acc = vmlaq_u16(vmulq_u16(a, vsubq_u16(full, w1)), b, w1);
+    vst1_u8(d + x * 4, vmovn_u16(vrshrq_n_u16(acc, 8)));
+  }
+  return x;
+}
+
+#elif defined(SLIDERUI_PIXEL_SSE2)
+
+// Products stay below 2^16 (255 * 256 plus rounding), so 16-bit unsigned lanes suffice.
+int vert_simd(const uint8_t *r0, const uint8_t *r1, uint16_t *tmp, int bytes, unsigned fy) {
+  const __m128i z = _mm_setzero_si128(), rnd = _mm_set1_epi16(128);
+  const __m128i w1 = _mm_set1_epi16(static_cast<short>(fy)), w0 = _mm_set1_epi16(static_cast<short>(256 - fy));
+  int k = 0;
+  for (; k + 16 <= bytes; k += 16) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(r0 + k));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(r1 + k));
+    const __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, z), w0), _mm_mullo_epi16(_mm_unpacklo_epi8(b, z), w1));
+    const __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, z), w0), _mm_mullo_epi16(_mm_unpackhi_epi8(b, z), w1));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(tmp + k), _mm_srli_epi16(_mm_add_epi16(lo, rnd), 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(tmp + k + 8), _mm_srli_epi16(_mm_add_epi16(hi, rnd), 8));
+  }
+  return k;
+}
+
+// Two pixels of one horizontal tap as 8 x u16
+inline __m128i load2_px(const uint16_t *tmp, int o0, int o1) {
+  return _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(tmp + o0 * 4)),
+                            _mm_loadl_epi64(reinterpret_cast<const __m128i *>(tmp + o1 * 4)));
+}
+
+inline __m128i lerp2_px(const uint16_t *tmp, const int *off0, const int *off1, const uint16_t *fx4) {
+  const __m128i w1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(fx4));
+  const __m128i w0 = _mm_sub_epi16(_mm_set1_epi16(256), w1);
+  const __m128i acc = _mm_add_epi16(_mm_mullo_epi16(load2_px(tmp, off0[0], off0[1]), w0),
+                                    _mm_mullo_epi16(load2_px(tmp, off1[0], off1[1]), w1));
+  return _mm_srli_epi16(_mm_add_epi16(acc, _mm_set1_epi16(128)), 8);
+}
+
+// 4 destination pixels per iteration
+int horz_simd(const uint16_t *tmp, const int *off0, const int *off1, const uint16_t *fx4, uint8_t *d, int n) {
+  int x = 0;
+  for (; x + 4 <= n; x += 4) {
+    const __m128i p01 = lerp2_px(tmp, off0 + x, off1 + x, fx4 + x * 4);
+    const __m128i p23 = lerp2_px(tmp, off0 + x + 2, off1 + x + 2, fx4 + x * 4 + 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(d + x * 4), _mm_packus_epi16(p01, p23));
+  }
+  return x;
+}
+
+#else
+
+int vert_simd(const uint8_t *, const uint8_t *, uint16_t *, int, unsigned) { return 0; }
+int horz_simd(const uint16_t *, const int *, const int *, const uint16_t *, uint8_t *, int) { return 0; }
+
+#endif
+
+template <bool kSimd>
+void scale_blit_32_impl(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst, int dst_pitch,
+                        const BlitRect &to, const BlitRect &clip, BlitFilter filter) {
+  BlitRect vis;
+  if (!src || !dst || src_w <= 0 || src_h <= 0 || !visible_rect(to, clip, vis)) return;
+  const bool bilinear = filter == BlitFilter::BILINEAR;
+  AxisMap xm, ym;
+  map_axis(src_w, to.w, vis.x - to.x, vis.x - to.x + vis.w, bilinear, xm);
+  map_axis(src_h, to.h, vis.y - to.y, vis.y - to.y + vis.h, bilinear, ym);
+  if (!bilinear) {
+    blit_nearest<uint32_t>(src, src_w, src_pitch, dst, dst_pitch, to, vis, xm, ym);
+    return;
+  }
+
+  // Only the source columns the visible pixels touch go through the vertical pass
+  const int lo = xm.idx0.front(), span = xm.idx1.back() - lo + 1;
+  for (int x = 0; x < vis.w; ++x) {
+    xm.idx0[x] -= lo;
+    xm.idx1[x] -= lo;
+  }
+  std::vector<uint16_t> fx4(static_cast<size_t>(vis.w) * 4);
+  for (int x = 0; x < vis.w; ++x) std::fill_n(fx4.begin() + x * 4, 4, xm.frac[x]);
+  std::vector<uint16_t> tmp(static_cast<size_t>(span) * 4);
+
+  for (int y = 0; y < vis.h; ++y) {
+    const uint8_t *r0 = src + static_cast<size_t>(ym.idx0[y]) * src_pitch + static_cast<size_t>(lo) * 4;
+    const uint8_t *r1 = src + static_cast<size_t>(ym.idx1[y]) * src_pitch + static_cast<size_t>(lo) * 4;
+    uint8_t *d = dst + static_cast<size_t>(vis.y + y) * dst_pitch + static_cast<size_t>(vis.x) * 4;
+    int k = kSimd ? vert_simd(r0, r1, tmp.data(), span * 4, ym.frac[y]) : 0;
+    vert_scalar(r0 + k, r1 + k, tmp.data() + k, span * 4 - k, ym.frac[y]);
+    int x = kSimd ? horz_simd(tmp.data(), xm.idx0.data(), xm.idx1.data(), fx4.data(), d, vis.w) : 0;
+    horz_scalar(tmp.data(), xm.idx0.data() + x, xm.idx1.data() + x, fx4.data() + x * 4, d + x * 4, vis.w - x);
+  }
+}
+
+constexpr uint32_t kRound565 = 0x02008010u; // 16 in each channel's lowest bit position
+
+inline uint32_t lerp565(uint32_t a, uint32_t b, uint32_t w) {
+  return ((a * (32 - w) + b * w + kRound565) >> 5) & kMask565;
+}
+
+} // namespace
+
+void scale_blit_32(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst, int dst_pitch,
+                   const BlitRect &to, const BlitRect &clip, BlitFilter filter) {
+  scale_blit_32_impl<true>(src, src_w, src_h, src_pitch, dst, dst_pitch, to, clip, filter);
+}
+
+void scale_blit_32_scalar(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst,
+                          int dst_pitch, const BlitRect &to, const BlitRect &clip, BlitFilter filter) {
+  scale_blit_32_impl<false>(src, src_w, src_h, src_pitch, dst, dst_pitch, to, clip, filter);
+}
+
+void scale_blit_16(const uint8_t *src, int src_w, int src_h, int src_pitch, uint8_t *dst, int dst_pitch,
+                   const BlitRect &to, const BlitRect &clip, BlitFilter filter) {
+  BlitRect vis;
+  if (!src || !dst || src_w <= 0 || src_h <= 0 || !visible_rect(to, clip, vis)) return;
+  const bool bilinear = filter == BlitFilter::BILINEAR;
+  AxisMap xm, ym;
+  map_axis(src_w, to.w, vis.x - to.x, vis.x - to.x + vis.w, bilinear, xm);
+  map_axis(src_h, to.h, vis.y - to.y, vis.y - to.y + vis.h, bilinear, ym);
+  if (!bilinear) {
+    blit_nearest<uint16_t>(src, src_w, src_pitch, dst, dst_pitch, to, vis, xm, ym);
+    return;
+  }
+
+  const int lo = xm.idx0.front(), span = xm.idx1.back() - lo + 1;
+  std::vector<uint32_t> tmp(span);
+  for (int y = 0; y < vis.h; ++y) {
+    const uint16_t *r0 = reinterpret_cast<const uint16_t *>(src + static_cast<size_t>(ym.idx0[y]) * src_pitch) + lo;
+    const uint16_t *r1 = reinterpret_cast<const uint16_t *>(src + static_cast<size_t>(ym.idx1[y]) * src_pitch) + lo;
+    uint16_t *d = reinterpret_cast<uint16_t *>(dst + static_cast<size_t>(vis.y + y) * dst_pitch) + vis.x;
+    const uint32_t fy = (ym.frac[y] + 4u) >> 3;
+    for (int k = 0; k < span; ++k) tmp[k] = lerp565(expand565(r0[k]), expand565(r1[k]), fy);
+    for (int x = 0; x < vis.w; ++x) {
+      const uint32_t fx = (xm.frac[x] + 4u) >> 3;
+      d[x] = pack565x(lerp565(tmp[xm.idx0[x] - lo], tmp[xm.idx1[x] - lo], fx));
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Alpha blending
+
+static inline unsigned alpha_weight(unsigned a) { return a + (a >> 7); } // 0..255 -> 0..256
+static inline unsigned mask_alpha(unsigned m, unsigned alpha) { // round(m * alpha / 255)
+  const unsigned x = m * alpha + 128;
+  return (x + (x >> 8)) >> 8;
+}
+static inline unsigned mix8(unsigned s, unsigned d, unsigned k) { return (s * k + d * (256 - k) + 128) >> 8; }
+
+static inline uint32_t mix32(uint32_t s, uint32_t d, unsigned k) {
+  uint32_t out = 0;
+  for (int sh = 0; sh < 32; sh += 8) out |= mix8((s >> sh) & 0xFF, (d >> sh) & 0xFF, k) << sh;
+  return out;
+}
+
+static inline uint16_t mix565(unsigned sr, unsigned sg, unsigned sb, uint16_t d, unsigned k) {
+  return static_cast<uint16_t>((mix8(sr, d >> 11, k) << 11) | (mix8(sg, (d >> 5) & 63, k) << 5) | mix8(sb, d & 31, k));
+}
+
+static void color32_row_scalar(uint32_t *d, int n, uint32_t pixel, unsigned alpha, const uint8_t *mask) {
+  const unsigned k = alpha_weight(alpha);
+  for (int x = 0; x < n; ++x) d[x] = mix32(pixel, d[x], mask ? alpha_weight(mask_alpha(mask[x], alpha)) : k);
+}
+
+static void color565_row_scalar(uint16_t *d, int n, uint16_t pixel, unsigned alpha, const uint8_t *mask) {
+  const unsigned k = alpha_weight(alpha);
+  const unsigned sr = pixel >> 11, sg = (pixel >> 5) & 63, sb = pixel & 31;
+  for (int x = 0; x < n; ++x) d[x] = mix565(sr, sg, sb, d[x], mask ? alpha_weight(mask_alpha(mask[x], alpha)) : k);
+}
+
+static void argb32_row_scalar(const uint32_t *s, uint32_t *d, int n) {
+  for (int x = 0; x < n; ++x) d[x] = mix32(s[x], d[x], alpha_weight(s[x] >> 24));
+}
+
+static void argb565_row_scalar(const uint32_t *s, uint16_t *d, int n) {
+  for (int x = 0; x < n; ++x) {
+    const uint32_t v = s[x];
+    d[x] = mix565((v >> 19) & 31, (v >> 10) & 63, (v >> 3) & 31, d[x], alpha_weight(v >> 24));
+  }
+}
+
+#if defined(SLIDERUI_PIXEL_NEON)
+
+// Per-pixel weights of 4 pixels broadcast to their 4 byte lanes: {k0 x4, k1 x4}, {k2 x4, k3 x4}
+static inline uint16x8x2_t spread4(uint16x4_t k) {
+  const uint16x4x2_t pairs = vzip_u16(k, k);                // k0 k0 k1 k1 | k2 k2 k3 k3
+  const uint16x4x2_t lo = vzip_u16(pairs.val[0], pairs.val[0]);
+  const uint16x4x2_t hi = vzip_u16(pairs.val[1], pairs.val[1]);
+  uint16x8x2_t out;
+  out.val[0] = vcombine_u16(lo.val[0], lo.val[1]);
+  out.val[1] = vcombine_u16(hi.val[0], hi.val[1]);
+  return out;
+}
+
+// mask_alpha + alpha_weight on 16-bit lanes
+static inline uint16x8_t mask_weight(uint16x8_t m, uint16_t alpha) {
+  uint16x8_t x = vaddq_u16(vmulq_n_u16(m, alpha), vdupq_n_u16(128));
+  x = vshrq_n_u16(vaddq_u16(x, vshrq_n_u16(x, 8)), 8);
+  return vaddq_u16(x, vshrq_n_u16(x, 7));
+}
+
+static inline uint16x8_t mix_u16(uint16x8_t s, uint16x8_t d, uint16x8_t k) {
+  // s*k + d*(256-k) <= 65280, so the rounding shift can't overflow
+  return vrshrq_n_u16(vmlaq_u16(vmulq_u16(s, k), d, vsubq_u16(vdupq_n_u16(256), k)), 8);
+}
+
+static int color32_row_simd(uint32_t *d, int n, uint32_t pixel, unsigned alpha, const uint8_t *mask) {
+  const uint16x8_t s = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(pixel)));
+  const uint16x8_t kc = vdupq_n_u16(static_cast<uint16_t>(alpha_weight(alpha)));
+  int x = 0;
+  for (; x + 4 <= n; x += 4) {
+    uint8_t *p = reinterpret_cast<uint8_t *>(d + x);
+    const uint8x16_t v = vld1q_u8(p);
+    uint16x8_t klo = kc, khi = kc;
+    if (mask) {
+      uint32_t m4;
+      std::memcpy(&m4, mask + x, 4);
+      const uint16x8_t k = mask_weight(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(m4))), static_cast<uint16_t>(alpha));
+      const uint16x8x2_t spread = spread4(vget_low_u16(k));
+      klo = spread.val[0];
+      khi = spread.val[1];
+    }
+    const uint16x8_t lo = mix_u16(s, vmovl_u8(vget_low_u8(v)), klo);
+    const uint16x8_t hi = mix_u16(s, vmovl_u8(vget_high_u8(v)), khi);
+    vst1q_u8(p, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+  }
+  return x;
+}
+
+static int color565_row_simd(uint16_t *d, int n, uint16_t pixel, unsigned alpha, const uint8_t *mask) {
+  const uint16x8_t sr = vdupq_n_u16(pixel >> 11), sg = vdupq_n_u16((pixel >> 5) & 63), sb = vdupq_n_u16(pixel & 31);
+  const uint16x8_t kc = vdupq_n_u16(static_cast<uint16_t>(alpha_weight(alpha)));
+  const uint16x8_t m6 = vdupq_n_u16(63), m5 = vdupq_n_u16(31);
+  int x = 0;
+  for (; x + 8 <= n; x += 8) {
+    const uint16x8_t v = vld1q_u16(d + x);
+    const uint16x8_t k = mask ? mask_weight(vmovl_u8(vld1_u8(mask + x)), static_cast<uint16_t>(alpha)) : kc;
+    const uint16x8_t r = mix_u16(sr, vshrq_n_u16(v, 11), k);
+    const uint16x8_t g = mix_u16(sg, vandq_u16(vshrq_n_u16(v, 5), m6), k);
+    const uint16x8_t b = mix_u16(sb, vandq_u16(v, m5), k);
+    vst1q_u16(d + x, vorrq_u16(vorrq_u16(vshlq_n_u16(r, 11), vshlq_n_u16(g, 5)), b));
+  }
+  return x;
+}
+
+static int argb32_row_simd(const uint32_t *s, uint32_t *d, int n) {
+  int x = 0;
+  for (; x + 4 <= n; x += 4) {
+    const uint32x4_t sv = vld1q_u32(s + x);
+    const uint32x4_t a = vshrq_n_u32(sv, 24);
+    const uint16x8x2_t k = spread4(vmovn_u32(vaddq_u32(a, vshrq_n_u32(a, 7))));
+    const uint8x16_t sb = vreinterpretq_u8_u32(sv);
+    uint8_t *p = reinterpret_cast<uint8_t *>(d + x);
+    const uint8x16_t db = vld1q_u8(p);
+    const uint16x8_t lo = mix_u16(vmovl_u8(vget_low_u8(sb)), vmovl_u8(vget_low_u8(db)), k.val[0]);
+    const uint16x8_t hi = mix_u16(vmovl_u8(vget_high_u8(sb)), vmovl_u8(vget_high_u8(db)), k.val[1]);
+    vst1q_u8(p, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+  }
+  return x;
+}
+
+static int argb565_row_simd(const uint32_t *s, uint16_t *d, int n) {
+  const uint16x4_t m6 = vdup_n_u16(63), m5 = vdup_n_u16(31), full = vdup_n_u16(256);
+  int x = 0;
+  for (; x + 4 <= n; x += 4) {
+    const uint32x4_t sv = vld1q_u32(s + x);
+    const uint16x4_t a = vmovn_u32(vshrq_n_u32(sv, 24));
+    const uint16x4_t k = vadd_u16(a, vshr_n_u16(a, 7)), ik = vsub_u16(full, k);
+    const uint16x4_t sr = vand_u16(vmovn_u32(vshrq_n_u32(sv, 19)), m5);
+    const uint16x4_t sg = vand_u16(vmovn_u32(vshrq_n_u32(sv, 10)), m6);
+    const uint16x4_t sbl = vand_u16(vmovn_u32(vshrq_n_u32(sv, 3)), m5);
+    const uint16x4_t v = vld1_u16(d + x);
+    const uint16x4_t r = vrshr_n_u16(vmla_u16(vmul_u16(sr, k), vshr_n_u16(v, 11), ik), 8);
+    const uint16x4_t g = vrshr_n_u16(vmla_u16(vmul_u16(sg, k), vand_u16(vshr_n_u16(v, 5), m6), ik), 8);
+    const uint16x4_t b = vrshr_n_u16(vmla_u16(vmul_u16(sbl, k), vand_u16(v, m5), ik), 8);
+    vst1_u16(d + x, vorr_u16(vorr_u16(vshl_n_u16(r, 11), vshl_n_u16(g, 5)), b));
+  }
+  return x;
+}
+
+#elif defined(SLIDERUI_PIXEL_SSE2)
+
+// Per-pixel weights (lanes 0..3) broadcast to their 4 byte lanes: {k0 x4, k1 x4}, {k2 x4, k3 x4}
+static inline void spread4(__m128i k, __m128i &lo, __m128i &hi) {
+  const __m128i pairs = _mm_unpacklo_epi16(k, k); // k0 k0 k1 k1 k2 k2 k3 k3
+  lo = _mm_unpacklo_epi32(pairs, pairs);
+  hi = _mm_unpackhi_epi32(pairs, pairs);
+}
+
+// mask_alpha + alpha_weight on 16-bit lanes
+static inline __m128i mask_weight(__m128i m, short alpha) {
+  __m128i x = _mm_add_epi16(_mm_mullo_epi16(m, _mm_set1_epi16(alpha)), _mm_set1_epi16(128));
+  x = _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+  return _mm_add_epi16(x, _mm_srli_epi16(x, 7));
+}
+
+// s*k + d*(256-k) + 128 <= 65408 fits unsigned 16-bit lanes
+static inline __m128i mix_u16(__m128i s, __m128i d, __m128i k) {
+  const __m128i acc = _mm_add_epi16(_mm_mullo_epi16(s, k), _mm_mullo_epi16(d, _mm_sub_epi16(_mm_set1_epi16(256), k)));
+  return _mm_srli_epi16(_mm_add_epi16(acc, _mm_set1_epi16(128)), 8);
+}
+
+static int color32_row_simd(uint32_t *d, int n, uint32_t pixel, unsigned alpha, const uint8_t *mask) {
+  const __m128i z = _mm_setzero_si128();
+  const __m128i s = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(pixel)), z);
+  const __m128i kc = _mm_set1_epi16(static_cast<short>(alpha_weight(alpha)));
+  int x = 0;
+  for (; x + 4 <= n; x += 4) {
+    __m128i *p = reinterpret_cast<__m128i *>(d + x);
+    const __m128i v = _mm_loadu_si128(p);
+    __m128i klo = kc, khi = kc;
+    if (mask) {
+      int m4;
+      std::memcpy(&m4, mask + x, 4);
+      spread4(mask_weight(_mm_unpacklo_epi8(_mm_cvtsi32_si128(m4), z), static_cast<short>(alpha)), klo, khi);
+    }
+    const __m128i lo = mix_u16(s, _mm_unpacklo_epi8(v, z), klo);
+    const __m128i hi = mix_u16(s, _mm_unpackhi_epi8(v, z), khi);
+    _mm_storeu_si128(p, _mm_packus_epi16(lo, hi));
+  }
+  return x;
+}
+
+static int color565_row_simd(uint16_t *d, int n, uint16_t pixel, unsigned alpha, const uint8_t *mask) {
+  const __m128i z = _mm_setzero_si128();
+  const __m128i sr = _mm_set1_epi16(static_cast<short>(pixel >> 11));
+  const __m128i sg = _mm_set1_epi16(static_cast<short>((pixel >> 5) & 63));
+  const __m128i sb = _mm_set1_epi16(static_cast<short>(pixel & 31));
+  const __m128i kc = _mm_set1_epi16(static_cast<short>(alpha_weight(alpha)));
+  const __m128i m6 = _mm_set1_epi16(63), m5 = _mm_set1_epi16(31);
+  int x = 0;
+  for (; x + 8 <= n; x += 8) {
+    __m128i *p = reinterpret_cast<__m128i *>(d + x);
+    const __m128i v = _mm_loadu_si128(p);
+    const __m128i k = mask ? mask_weight(_mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mask + x)), z),
+                                         static_cast<short>(alpha))
+                           : kc;
+    const __m128i r = mix_u16(sr, _mm_srli_epi16(v, 11), k);
+    const __m128i g = mix_u16(sg, _mm_and_si128(_mm_srli_epi16(v, 5), m6), k);
+    const __m128i b = mix_u16(sb, _mm_and_si128(v, m5), k);
+    _mm_storeu_si128(p, _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b));
+  }
+  return x;
+}
+
+// Weights of 4 ARGB pixels as 16-bit lanes 0..3
+static inline __m128i argb_weight(__m128i sv) {
+  const __m128i a = _mm_srli_epi32(sv, 24);
+  const __m128i k = _mm_add_epi32(a, _mm_srli_epi32(a, 7));
+  return _mm_packs_epi32(k, k);
+}
+
+static int argb32_row_simd(const uint32_t *s, uint32_t *d, int n) {
+  const __m128i z = _mm_setzero_si128();
+  int x = 0;
+  for (; x + 4 <= n; x += 4) {
+    const __m128i sv = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + x));
+    __m128i *p = reinterpret_cast<__m128i *>(d + x);
+    const __m128i v = _mm_loadu_si128(p);
+    __m128i klo, khi;
+    spread4(argb_weight(sv), klo, khi);
+    const __m128i lo = mix_u16(_mm_unpacklo_epi8(sv, z), _mm_unpacklo_epi8(v, z), klo);
+    const __m128i hi = mix_u16(_mm_unpackhi_epi8(sv, z), _mm_unpackhi_epi8(v, z), khi);
+    _mm_storeu_si128(p, _mm_packus_epi16(lo, hi));
+  }
+  return x;
+}
+
+static int argb565_row_simd(const uint32_t *s, uint16_t *d, int n) {
+  const __m128i m6 = _mm_set1_epi32(63), m5 = _mm_set1_epi32(31);
+  int x = 0;
+  for (; x + 4 <= n; x += 4) {
+    const __m128i sv = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + x));
+    const __m128i k = argb_weight(sv);
+    const __m128i sr = _mm_and_si128(_mm_srli_epi32(sv, 19), m5);
+    const __m128i sg = _mm_and_si128(_mm_srli_epi32(sv, 10), m6);
+    const __m128i sb = _mm_and_si128(_mm_srli_epi32(sv, 3), m5);
+    const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(d + x));
+    const __m128i r = mix_u16(_mm_packs_epi32(sr, sr), _mm_srli_epi16(v, 11), k);
+    const __m128i g = mix_u16(_mm_packs_epi32(sg, sg), _mm_and_si128(_mm_srli_epi16(v, 5), _mm_set1_epi16(63)), k);
+    const __m128i b = mix_u16(_mm_packs_epi32(sb, sb), _mm_and_si128(v, _mm_set1_epi16(31)), k);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(d + x),
+                     _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b));
+  }
+  return x;
+}
+
+#else
+
+static int color32_row_simd(uint32_t *, int, uint32_t, unsigned, const uint8_t *) { return 0; }
+static int color565_row_simd(uint16_t *, int, uint16_t, unsigned, const uint8_t *) { return 0; }
+static int argb32_row_simd(const uint32_t *, uint32_t *, int) { return 0; }
+static int argb565_row_simd(const uint32_t *, uint16_t *, int) { return 0; }
+
+#endif
+
+template <bool kSimd, typename Pixel, typename Value>
+static void blend_color_impl(uint8_t *dst, int dst_pitch, int w, int h, Value pixel, uint8_t alpha,
+                             const uint8_t *mask, int mask_pitch,
+                             int (*row_simd)(Pixel *, int, Value, unsigned, const uint8_t *),
+                             void (*row_scalar)(Pixel *, int, Value, unsigned, const uint8_t *)) {
+  if (!dst || w <= 0 || h <= 0 || (alpha == 0 && !mask)) return;
+  for (int y = 0; y < h; ++y) {
+    Pixel *d = reinterpret_cast<Pixel *>(dst + static_cast<size_t>(y) * dst_pitch);
+    const uint8_t *m = mask ? mask + static_cast<size_t>(y) * mask_pitch : nullptr;
+    const int x = kSimd ? row_simd(d, w, pixel, alpha, m) : 0;
+    row_scalar(d + x, w - x, pixel, alpha, m ? m + x : nullptr);
+  }
+}
+
+template <bool kSimd, typename Pixel>
+static void blend_argb_impl(const uint8_t *src, int src_pitch, uint8_t *dst, int dst_pitch, int w, int h,
+                            int (*row_simd)(const uint32_t *, Pixel *, int),
+                            void (*row_scalar)(const uint32_t *, Pixel *, int)) {
+  if (!src || !dst || w <= 0 || h <= 0) return;
+  for (int y = 0; y < h; ++y) {
+    const uint32_t *s = reinterpret_cast<const uint32_t *>(src + static_cast<size_t>(y) * src_pitch);
+    Pixel *d = reinterpret_cast<Pixel *>(dst + static_cast<size_t>(y) * dst_pitch);
+    const int x = kSimd ? row_simd(s, d, w) : 0;
+    row_scalar(s + x, d + x, w - x);
+  }
+}
+
+void blend_color_32(uint8_t *dst, int dst_pitch, int w, int h, uint32_t pixel, uint8_t alpha, const uint8_t *mask,
+                    int mask_pitch) {
+  blend_color_impl<true, uint32_t, uint32_t>(dst, dst_pitch, w, h, pixel, alpha, mask, mask_pitch, color32_row_simd,
+                                             color32_row_scalar);
+}
+
+void blend_color_32_scalar(uint8_t *dst, int dst_pitch, int w, int h, uint32_t pixel, uint8_t alpha,
+                           const uint8_t *mask, int mask_pitch) {
+  blend_color_impl<false, uint32_t, uint32_t>(dst, dst_pitch, w, h, pixel, alpha, mask, mask_pitch, color32_row_simd,
+                                              color32_row_scalar);
+}
+
+void blend_color_565(uint8_t *dst, int dst_pitch, int w, int h, uint16_t pixel, uint8_t alpha, const uint8_t *mask,
+                     int mask_pitch) {
+  blend_color_impl<true, uint16_t, uint16_t>(dst, dst_pitch, w, h, pixel, alpha, mask, mask_pitch, color565_row_simd,
+                                             color565_row_scalar);
+}
+
+void blend_color_565_scalar(uint8_t *dst, int dst_pitch, int w, int h, uint16_t pixel, uint8_t alpha,
+                            const uint8_t *mask, int mask_pitch) {
+  blend_color_impl<false, uint16_t, uint16_t>(dst, dst_pitch, w, h, pixel, alpha, mask, mask_pitch,
+                                              color565_row_simd, color565_row_scalar);
+}
+
+void blend_argb_32(const uint8_t *src, int src_pitch, uint8_t *dst, int dst_pitch, int w, int h) {
+  blend_argb_impl<true, uint32_t>(src, src_pitch, dst, dst_pitch, w, h, argb32_row_simd, argb32_row_scalar);
+}
+
+void blend_argb_32_scalar(const uint8_t *src, int src_pitch, uint8_t *dst, int dst_pitch, int w, int h) {
+  blend_argb_impl<false, uint32_t>(src, src_pitch, dst, dst_pitch, w, h, argb32_row_simd, argb32_row_scalar);
+}
+
+void blend_argb_565(const uint8_t *src, int src_pitch, uint8_t *dst, int dst_pitch, int w, int h) {
+  blend_argb_impl<true, uint16_t>(src, src_pitch, dst, dst_pitch, w, h, argb565_row_simd, argb565_row_scalar);
+}
+
+void blend_argb_565_scalar(const uint8_t *src, int src_pitch, uint8_t *dst, int dst_pitch, int w, int h) {
+  blend_argb_impl<false, uint16_t>(src, src_pitch, dst, dst_pitch, w, h, argb565_row_simd, argb565_row_scalar);
+}
+
+} // namespace core
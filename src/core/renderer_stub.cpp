@@ -88,7 +88,8 @@ void Renderer::draw_background(const std::string &path) {
     std::cout << "[renderer] draw_background: " << path << "\n";
 }
 
-void Renderer::draw_game_carousel(const std::vector<Game> &view, std::size_t active, ImageCache *cache) {
+void Renderer::draw_game_carousel(const std::vector<Game> &view, std::size_t active, ImageCache *cache, float scroll) {
+    (void)scroll;
     std::cout << "[renderer] draw_game_carousel (size=" << view.size() << ", active=" << active << ")\n";
     for (std::size_t i = 0; i < view.size(); ++i) {
         const Game &g = view[i];
@@ -110,4 +111,8 @@ void Renderer::draw_overlay(const std::string &msg) {
     std::cout << "[renderer] overlay: " << msg << "\n";
 }
 
+void Renderer::draw_button_bar(const std::string &hints) {
+    std::cout << "[renderer] buttons: " << hints << "\n";
+}
+
 } // namespace ui
@@ -0,0 +1,98 @@
+// src/core/thread_pool.cpp
+#include "core/thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace core {
+
+ThreadPool::ThreadPool(unsigned threads) {
+  if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+  workers_.reserve(threads);
+  for (unsigned i = 0; i < threads; ++i) workers_.emplace_back([this] { worker_loop(); });
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    stopping_ = true;
+  }
+  cv_.notify_all();
+  for (auto &t : workers_) t.join();
+}
+
+void ThreadPool::enqueue(std::function<void()> job) {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    queue_.push_back(std::move(job));
+  }
+  cv_.notify_one();
+}
+
+void ThreadPool::worker_loop() {
+  for (;;) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(mtx_);
+      cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) return; // stopping and drained
+      job = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    job();
+  }
+}
+
+namespace {
+// Shared by the caller and its helpers; helpers that start after the last item is done
+// find nothing left to claim and never touch `fn`.
+struct ForState {
+  const std::function<void(size_t)> *fn = nullptr;
+  size_t count = 0;
+  std::atomic<size_t> next{0};
+  size_t done = 0;
+  std::exception_ptr error; // first exception thrown by fn, rethrown to the caller
+  std::mutex mtx;
+  std::condition_variable cv;
+
+  void run() {
+    size_t finished = 0;
+    std::exception_ptr err;
+    for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < count; ++finished) {
+      try {
+        (*fn)(i);
+      } catch (...) {
+        if (!err) err = std::current_exception();
+      }
+    }
+    if (finished == 0) return;
+    std::lock_guard<std::mutex> lock(mtx);
+    if (err && !error) error = err;
+    done += finished;
+    if (done == count) cv.notify_all();
+  }
+};
+} // namespace
+
+void ThreadPool::parallel_for(size_t count, const std::function<void(size_t)> &fn, unsigned max_parallel) {
+  if (count == 0) return;
+  if (max_parallel == 0) max_parallel = size() + 1;
+  size_t helpers = std::min<size_t>({static_cast<size_t>(max_parallel) - 1, count - 1, workers_.size()});
+
+  auto st = std::make_shared<ForState>();
+  st->fn = &fn;
+  st->count = count;
+  for (size_t i = 0; i < helpers; ++i) enqueue([st] { st->run(); });
+  st->run();
+  std::unique_lock<std::mutex> lock(st->mtx);
+  st->cv.wait(lock, [&] { return st->done == st->count; });
+  if (st->error) std::rethrow_exception(st->error);
+}
+
+ThreadPool &ThreadPool::shared() {
+  static ThreadPool pool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+  return pool;
+}
+
+} // namespace core
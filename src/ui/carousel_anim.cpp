@@ -0,0 +1,118 @@
+// src/ui/carousel_anim.cpp
+#include "ui/carousel_anim.h"
+#include "core/config_manager.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace ui {
+
+namespace {
+// A selection never needs to scroll further than the slots drawn around the active one
+constexpr float kMaxScroll = 2.f;
+// A frame longer than this is a stall (loading, launching): simulate only this much of it
+constexpr float kMaxFrameMs = 100.f;
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+Easing easing_from_string(const std::string &name, Easing fallback) {
+    std::string n(name);
+    for (auto &c : n) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    if (n == "linear") return Easing::LINEAR;
+    if (n == "ease_out_cubic") return Easing::EASE_OUT_CUBIC;
+    if (n == "ease_in_out_quad") return Easing::EASE_IN_OUT_QUAD;
+    return fallback;
+}
+
+float ease(Easing e, float t) {
+    t = std::min(1.f, std::max(0.f, t));
+    switch (e) {
+        case Easing::LINEAR:
+            return t;
+        case Easing::EASE_IN_OUT_QUAD:
+            return t < 0.5f ? 2.f * t * t : 1.f - (2.f - 2.f * t) * (2.f - 2.f * t) / 2.f;
+        case Easing::EASE_OUT_CUBIC:
+        default: {
+            const float u = 1.f - t;
+            return 1.f - u * u * u;
+        }
+    }
+}
+
+CarouselAnimator::CarouselAnimator(float duration_ms, float step_ms, Easing easing)
+    : duration_ms_(std::max(0.f, duration_ms)), step_ms_(std::max(1.f, step_ms)), easing_(easing) {}
+
+void CarouselAnimator::configure(const core::ConfigManager &cfg) {
+    duration_ms_ = static_cast<float>(std::max(0, cfg.get<int>("ui.animation.duration_ms", 180)));
+    easing_ = easing_from_string(cfg.get<std::string>("ui.animation.easing", "ease_out_cubic"));
+    reset();
+}
+
+void CarouselAnimator::reset() {
+    from_ = 0.f;
+    t_ms_ = 0.f;
+    acc_ms_ = 0.f;
+}
+
+float CarouselAnimator::value_at(float t_ms) const {
+    if (duration_ms_ <= 0.f || t_ms >= duration_ms_) return 0.f;
+    return from_ * (1.f - ease(easing_, t_ms / duration_ms_));
+}
+
+float CarouselAnimator::scroll() const {
+    return animating() ? value_at(t_ms_ + acc_ms_) : 0.f;
+}
+
+void CarouselAnimator::shift(int delta) {
+    // Retarget from where the carousel is right now: position is continuous, the new
+    // segment restarts the ease (ease-out keeps the motion going at full speed).
+    from_ = std::min(kMaxScroll, std::max(-kMaxScroll, scroll() + static_cast<float>(delta)));
+    t_ms_ = 0.f;
+    acc_ms_ = 0.f;
+    if (duration_ms_ <= 0.f) from_ = 0.f; // animation disabled: snap
+}
+
+void CarouselAnimator::advance(float elapsed_ms) {
+    if (!animating()) {
+        acc_ms_ = 0.f;
+        return;
+    }
+    acc_ms_ = std::min(acc_ms_ + std::max(0.f, elapsed_ms), std::max(step_ms_, kMaxFrameMs));
+    while (acc_ms_ >= step_ms_) {
+        acc_ms_ -= step_ms_;
+        t_ms_ += step_ms_;
+        if (t_ms_ >= duration_ms_) { // settled
+            reset();
+            return;
+        }
+    }
+}
+
+FramePacer::FramePacer(int fps) : period_ms_(1000.f / static_cast<float>(std::max(1, fps))) {}
+
+float FramePacer::wait() {
+    double now = now_ms();
+    if (prev_ms_ == 0) { // first frame
+        prev_ms_ = next_ms_ = now;
+        return 0.f;
+    }
+    last_work_ms_ = static_cast<float>(now - prev_ms_);
+    next_ms_ += period_ms_;
+    if (next_ms_ < now - period_ms_) next_ms_ = now; // overran by a frame or more: resync
+    if (next_ms_ > now) {
+        std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(next_ms_ - now));
+        now = now_ms();
+    }
+    const float dt = static_cast<float>(now - prev_ms_);
+    prev_ms_ = now;
+    return dt;
+}
+
+} // namespace ui
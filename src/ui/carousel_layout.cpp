@@ -0,0 +1,205 @@
+// src/ui/carousel_layout.cpp
+#include "ui/carousel_layout.h"
+#include "ui/draw_list.h"
+#include "core/config_manager.h"
+#include "core/file_utils.h"
+#include "core/game_db.h"
+#include "core/global.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+namespace ui {
+
+CarouselStyle carousel_style(const core::ConfigManager *cfg, int screen_w, int screen_h) {
+    CarouselStyle st;
+    st.center_x = screen_w / 2;
+    st.center_y = screen_h / 2 - 20;
+    st.contour.radius = 8;
+    st.contour.stroke = 3;
+    st.contour.hollow = true;
+    st.contour.border[0] = st.contour.border[1] = st.contour.border[2] = 255;
+    if (!cfg) return st;
+
+    st.center_x = cfg->get<int>("ui.game_image.x", st.center_x);
+    st.center_y = cfg->get<int>("ui.game_image.y", st.center_y);
+    st.active_w = cfg->get<int>("ui.game_image.width", st.active_w);
+    st.active_h = cfg->get<int>("ui.game_image.height", st.active_h);
+    st.spacing = cfg->get<int>("ui.game_image.margin", st.spacing);
+    // side dimensions follow the active ones
+    const double side_scale = cfg->get<double>("ui.game_image.side_scale", 0.78);
+    st.side_w = static_cast<int>(st.active_w * side_scale);
+    st.side_h = static_cast<int>(st.active_h * side_scale);
+    if (cfg->get<std::string>("ui.animation.filter", "bilinear") == "nearest") st.filter = core::BlitFilter::NEAREST;
+
+    st.glow = cfg->get<bool>("ui.selected_contour.glow", true);
+    uint8_t unused_a = 0;
+    core::parse_hex_color(cfg->get<std::string>("ui.selected_contour.glow_color", "#336699"),
+                          st.glow_rgb[0], st.glow_rgb[1], st.glow_rgb[2], unused_a);
+    st.glow_alpha = static_cast<uint8_t>(std::max(0, std::min(255, cfg->get<int>("ui.selected_contour.glow_alpha", 160))));
+    st.contour.radius = std::max(0, cfg->get<int>("ui.selected_contour.radius", 8));
+    st.contour.stroke = std::max(0, cfg->get<int>("ui.selected_contour.stroke", 3));
+    core::parse_hex_color(cfg->get<std::string>("ui.selected_contour.color", "#FFFFFF"),
+                          st.contour.border[0], st.contour.border[1], st.contour.border[2], unused_a);
+    return st;
+}
+
+std::vector<CarouselSlot> carousel_slots(size_t count, size_t active_index, float scroll, const CarouselStyle &st) {
+    std::vector<CarouselSlot> slots;
+    slots.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        CarouselSlot s;
+        s.index = i;
+        s.p = static_cast<float>(int(i) - int(active_index)) + scroll;
+        const float dist = std::fabs(s.p);
+        s.focused = dist < 0.5f;
+        // size follows the position: active size at the center, side size one slot out
+        const float t = std::min(1.f, dist);
+        s.w = static_cast<int>(std::lround(st.active_w + (st.side_w - st.active_w) * t));
+        s.h = static_cast<int>(std::lround(st.active_h + (st.side_h - st.active_h) * t));
+        s.prefitted = (s.w == st.active_w && s.h == st.active_h) || (s.w == st.side_w && s.h == st.side_h);
+        s.x = st.center_x + static_cast<int>(std::lround(s.p * (st.side_w + st.spacing))) - s.w / 2;
+        s.y = st.center_y - s.h / 2;
+        slots.push_back(s);
+    }
+    std::stable_sort(slots.begin(), slots.end(),
+                     [](const CarouselSlot &a, const CarouselSlot &b) { return std::fabs(a.p) > std::fabs(b.p); });
+    return slots;
+}
+
+std::string game_label(const core::Game &g) {
+    if (!g.name.empty()) return g.name;
+    const auto pos = g.path.find_last_of("/\\");
+    return pos == std::string::npos ? g.path : g.path.substr(pos + 1);
+}
+
+std::string carousel_art_path(const core::Game &g) {
+    static const char *const exts[] = {".png", ".jpg", ".jpeg", ".webp"};
+    const std::string base = global::g_exe_dir + "assets/img/" + game_label(g);
+    for (const char *ext : exts) {
+        const std::string full = base + ext;
+        FILE *f = fopen(full.c_str(), "rb");
+        if (f) { fclose(f); return full; }
+    }
+    return g.path;
+}
+
+SlotDraw carousel_slot_draw(const CarouselSlot &slot, const CarouselStyle &st, const std::string &art_path, bool has_art) {
+    SlotDraw d;
+    d.bounds = core::BlitRect{slot.x - kCarouselFrame, slot.y - kCarouselFrame,
+                              slot.w + 2 * kCarouselFrame, slot.h + 2 * kCarouselFrame};
+    const uint8_t placeholder = slot.focused ? 100 : 70;
+    d.placeholder[0] = d.placeholder[1] = placeholder;
+    d.placeholder[2] = slot.focused ? 140 : 90;
+    d.contour = slot.focused && st.contour.stroke > 0 && slot.w == st.active_w && slot.h == st.active_h;
+    DrawHash hash;
+    hash.add(std::string("slot")).add(d.bounds).add(art_path).add(int(has_art))
+        .add(int(slot.focused)).add(int(st.filter));
+    if (d.contour) hash.add(core::shape_key(d.bounds.w, d.bounds.h, st.contour));
+    d.hash = hash.value();
+    if (slot.focused) {
+        d.label_x = st.center_x - 200;
+        d.label_y = st.center_y + st.active_h / 2 + 8;
+    } else {
+        d.label_x = slot.x + 8;
+        d.label_y = slot.y + 8;
+    }
+    return d;
+}
+
+void CarouselGlow::update(const CarouselStyle &st) {
+    const int w = st.active_w + 2 * kCarouselFrame, h = st.active_h + 2 * kCarouselFrame;
+    if (w == frame_w_ && h == frame_h_) return;
+    frame_w_ = w;
+    frame_h_ = h;
+    mask_ = core::glow_mask(w, h, kCarouselGlowSpread);
+}
+
+GlowDraw CarouselGlow::draw(const CarouselSlot &slot, const CarouselStyle &st) const {
+    GlowDraw g;
+    g.alpha = static_cast<uint8_t>(std::lround(st.glow_alpha * (1.f - 2.f * std::fabs(slot.p))));
+    const int mw = mask_pitch(), mh = frame_h_ + 2 * kCarouselGlowSpread;
+    g.rect = core::BlitRect{slot.x + slot.w / 2 - mw / 2, slot.y + slot.h / 2 - mh / 2, mw, mh};
+    g.hash = DrawHash().add(std::string("glow")).add(g.rect).add(int(st.glow_rgb[0])).add(int(st.glow_rgb[1]))
+                       .add(int(st.glow_rgb[2])).add(int(g.alpha)).value();
+    return g;
+}
+
+OverlayLayout overlay_layout(int screen_w, int screen_h) {
+    OverlayLayout o;
+    o.dim = core::BlitRect{0, 0, screen_w, screen_h};
+    o.dim_hash = DrawHash().add(std::string("dim")).add(int(o.dim_alpha)).value();
+    const int h = 160;
+    o.box = core::BlitRect{50, (screen_h - h) / 2, screen_w - 100, h};
+    o.box_hash = DrawHash().add(std::string("box")).add(o.box).value();
+    o.text_x = o.box.x + 12;
+    o.text_y = o.box.y + 12;
+    return o;
+}
+
+ButtonBarLayout button_bar_layout(const core::ConfigManager *cfg, int screen_w, int screen_h, int text_w, int text_h) {
+    ButtonBarLayout l;
+    int x = 6;
+    int y = screen_h - 40;
+    int pad = 8;
+    std::string align = "left";
+    if (cfg) {
+        x = cfg->get<int>("ui.buttons.x", x);
+        y = cfg->get<int>("ui.buttons.y", y);
+        pad = std::max(0, cfg->get<int>("ui.buttons.padding", pad));
+        align = cfg->get<std::string>("ui.buttons.align", align);
+        core::parse_hex_color(cfg->get<std::string>("ui.buttons.background", "#000000AA"),
+                              l.rgba[0], l.rgba[1], l.rgba[2], l.rgba[3]);
+    }
+    const int bar_w = text_w + 2 * pad;
+    const int bar_h = text_h + 2 * pad;
+    int bar_x = x - pad;
+    if (align == "right") bar_x = x - bar_w;
+    else if (align == "center") bar_x = x - bar_w / 2;
+    bar_x = std::max(0, std::min(bar_x, screen_w - bar_w));
+    const int bar_y = std::max(0, std::min(y - pad, screen_h - bar_h));
+    l.bar = core::BlitRect{bar_x, bar_y, bar_w, bar_h};
+    l.hash = DrawHash().add(std::string("bar")).add(l.bar).add(int(l.rgba[0])).add(int(l.rgba[1]))
+                       .add(int(l.rgba[2])).add(int(l.rgba[3])).value();
+    l.text_x = bar_x + pad;
+    l.text_y = bar_y + pad;
+    return l;
+}
+
+core::ShapeStyle selector_style(int h) {
+    core::ShapeStyle st;
+    st.radius = std::max(1, h / 2);
+    st.stroke = 1;
+    st.border[0] = st.border[1] = st.border[2] = 60;
+    st.fill[0] = st.fill[1] = st.fill[2] = 96;
+    st.highlight = true;
+    st.hi[0] = st.hi[1] = st.hi[2] = 116;
+    return st;
+}
+
+uint64_t shape_hash(const core::BlitRect &r, const core::ShapeStyle &st) {
+    return DrawHash().add(core::shape_key(r.w, r.h, st)).add(r.x).add(r.y).value();
+}
+
+bool BackgroundSource::needs_reload(const std::string &image) {
+    const auto now = std::chrono::steady_clock::now();
+    bool reload = image != path;
+    if (!reload && !image.empty() && now - checked >= std::chrono::seconds(1)) {
+        checked = now;
+        reload = file_utils::file_mtime(image) != mtime;
+    }
+    if (reload) {
+        path = image;
+        mtime = file_utils::file_mtime(image);
+        checked = now;
+    }
+    return reload;
+}
+
+uint64_t BackgroundSource::hash() const {
+    return DrawHash().add(std::string("background")).add(path).add(mtime).value();
+}
+
+} // namespace ui
@@ -0,0 +1,106 @@
+// src/ui/draw_list.cpp
+#include "ui/draw_list.h"
+
+#include <algorithm>
+
+namespace ui {
+
+DrawHash &DrawHash::add(const void *data, size_t size) {
+    const unsigned char *p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        h_ ^= p[i];
+        h_ *= 1099511628211ull;
+    }
+    return *this;
+}
+
+void DrawList::set_screen(int width, int height, int tile) {
+    width_ = std::max(0, width);
+    height_ = std::max(0, height);
+    tile_ = std::max(1, tile);
+    cols_ = (width_ + tile_ - 1) / tile_;
+    rows_ = (height_ + tile_ - 1) / tile_;
+    cmds_.clear();
+    ended_ = false;
+    invalidate();
+}
+
+void DrawList::add(const core::BlitRect &bounds, uint64_t hash, Draw draw) {
+    if (ended_) {
+        cmds_.clear();
+        ended_ = false;
+    }
+    cmds_.push_back(Command{bounds, hash, std::move(draw)});
+}
+
+static bool intersects(const core::BlitRect &a, const core::BlitRect &b) {
+    return a.w > 0 && a.h > 0 && b.w > 0 && b.h > 0 &&
+           a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+std::vector<core::BlitRect> DrawList::end_frame() {
+    std::vector<core::BlitRect> regions;
+    if (ended_ || cmds_.empty()) return regions; // nothing recorded: the screen is as it was
+    ended_ = true;
+
+    // Fold each command's hash into every tile its bounds touch, in recording order
+    tiles_.assign(static_cast<size_t>(cols_) * rows_, 14695981039346656037ull);
+    for (const Command &c : cmds_) {
+        if (!intersects(c.bounds, core::BlitRect{0, 0, width_, height_})) continue;
+        const int c0 = std::max(0, c.bounds.x / tile_), c1 = std::min(cols_ - 1, (c.bounds.x + c.bounds.w - 1) / tile_);
+        const int r0 = std::max(0, c.bounds.y / tile_), r1 = std::min(rows_ - 1, (c.bounds.y + c.bounds.h - 1) / tile_);
+        for (int r = r0; r <= r1; ++r) {
+            for (int col = c0; col <= c1; ++col) {
+                uint64_t &t = tiles_[static_cast<size_t>(r) * cols_ + col];
+                t = (t ^ c.hash) * 1099511628211ull;
+            }
+        }
+    }
+
+    // Changed tiles, as horizontal runs per tile row; a run continuing the same span of the
+    // row above extends that rect downwards
+    const bool all = prev_tiles_.size() != tiles_.size();
+    std::vector<size_t> open; // indices into regions of rects ending at the previous row
+    for (int r = 0; r < rows_; ++r) {
+        std::vector<size_t> next_open;
+        int col = 0;
+        while (col < cols_) {
+            const size_t i = static_cast<size_t>(r) * cols_ + col;
+            if (!all && tiles_[i] == prev_tiles_[i]) { ++col; continue; }
+            int end = col;
+            while (end + 1 < cols_) {
+                const size_t j = static_cast<size_t>(r) * cols_ + end + 1;
+                if (!all && tiles_[j] == prev_tiles_[j]) break;
+                ++end;
+            }
+            const int x = col * tile_, w = std::min(width_, (end + 1) * tile_) - x;
+            const int y = r * tile_, h = std::min(height_, (r + 1) * tile_) - y;
+            auto above = std::find_if(open.begin(), open.end(),
+                                      [&](size_t k) { return regions[k].x == x && regions[k].w == w; });
+            if (above != open.end()) {
+                regions[*above].h += h;
+                next_open.push_back(*above);
+            } else {
+                regions.push_back(core::BlitRect{x, y, w, h});
+                next_open.push_back(regions.size() - 1);
+            }
+            col = end + 1;
+        }
+        open.swap(next_open);
+    }
+    prev_tiles_ = tiles_;
+    return regions;
+}
+
+void DrawList::replay(const core::BlitRect &region) const {
+    if (!ended_) return;
+    for (const Command &c : cmds_) {
+        if (intersects(c.bounds, region) && c.draw) c.draw();
+    }
+}
+
+void DrawList::invalidate() {
+    prev_tiles_.clear();
+}
+
+} // namespace ui
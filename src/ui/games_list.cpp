@@ -11,7 +11,6 @@
 #include <thread>
 
 using namespace std::chrono_literals;
-using core::Logger;
 using namespace ui::menu;
 
 namespace ui {
@@ -52,7 +51,7 @@ bool show_games_list(Renderer& renderer, GameListState& state) {
                 // Remove game from list
                 if (!games.empty()) {
                     const auto& game = games[state.selected_index];
-                    Logger::instance().info("Removing game: " + game.name);
+                    LOG_INFO(MENU, "Removing game: " + game.name);
                     if (const_cast<core::GameDB&>(state.game_db).remove(state.selected_index)) {
                         if (const_cast<core::GameDB&>(state.game_db).commit()) {
                             // Adjust indices if needed
@@ -63,7 +62,7 @@ bool show_games_list(Renderer& renderer, GameListState& state) {
                                 state.scroll_offset = games.empty() ? 0 : games.size() - 1;
                             }
                         } else {
-                            Logger::instance().error("Failed to commit game removal");
+                            LOG_ERROR(MENU, "Failed to commit game removal");
                         }
                     }
                 }
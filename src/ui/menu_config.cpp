@@ -19,7 +19,7 @@ bool MenuConfig::init(const std::string& config_path) {
 
 bool MenuConfig::reload() {
     if (!cfg_.load(config_path_)) {
-        core::Logger::instance().error("Failed to load menu config: " + config_path_);
+        LOG_ERROR(CONFIG, "Failed to load menu config: " + config_path_);
         return false;
     }
     initialized_ = true;
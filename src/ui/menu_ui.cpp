@@ -45,11 +45,12 @@ int menu_main(const std::string &config_path) {
 
   // Load config (if missing, ConfigManager should merge with defaults)
   bool ok = cfg.load(config_path);
+  Logger::instance().init_from_config(cfg, global::g_exe_dir);
   if (!ok) {
     std::cerr << "[menu] warning: failed to load config (will use defaults)\n";
-    Logger::instance().error(std::string("menu: failed to load config ") + config_path);
+    LOG_ERROR(MENU, "menu: failed to load config " + config_path);
   } else {
-    Logger::instance().info(std::string("menu: loaded config ") + config_path);
+    LOG_INFO(MENU, "menu: loaded config " + config_path);
   }
 
   // ensure keys exist by reading with fallbacks
@@ -92,9 +93,9 @@ int menu_main(const std::string &config_path) {
           cfg.set<std::string>("behavior.sort_mode", sort_mode);
           if (!cfg.save(config_path)) {
             std::cerr << "[menu] failed to save config after changing sort_mode\n";
-            Logger::instance().error("menu: failed to save config after sort_mode change");
+            LOG_ERROR(MENU, "menu: failed to save config after sort_mode change");
           } else {
-            Logger::instance().info(std::string("menu: sort change -> ") + sort_mode);
+            LOG_INFO(MENU, "menu: sort change -> " + sort_mode);
           }
         } else if (selected == START_GAME) {
           size_t idx = index_of(start_game_modes, start_game);
@@ -103,18 +104,18 @@ int menu_main(const std::string &config_path) {
           cfg.set<std::string>("behavior.start_game", start_game);
           if (!cfg.save(config_path)) {
             std::cerr << "[menu] failed to save config after changing start_game\n";
-            Logger::instance().error("menu: failed to save config after start_game change");
+            LOG_ERROR(MENU, "menu: failed to save config after start_game change");
           } else {
-            Logger::instance().info(std::string("menu: start_game change -> ") + start_game);
+            LOG_INFO(MENU, "menu: start_game change -> " + start_game);
           }
         } else if (selected == KIDS_MODE) {
           kids_mode_enabled = !kids_mode_enabled;
           cfg.set<bool>("behavior.kids_mode_enabled", kids_mode_enabled);
           if (!cfg.save(config_path)) {
             std::cerr << "[menu] failed to save config after toggling kids_mode\n";
-            Logger::instance().error("menu: failed to save config after kids_mode toggle");
+            LOG_ERROR(MENU, "menu: failed to save config after kids_mode toggle");
           } else {
-            Logger::instance().info(std::string("menu: kids_mode -> ") + (kids_mode_enabled ? "enabled" : "disabled"));
+            LOG_INFO(MENU, std::string("menu: kids_mode -> ") + (kids_mode_enabled ? "enabled" : "disabled"));
           }
           // do not execute external script; only log
           if (kids_mode_enabled) {
@@ -127,7 +128,7 @@ int menu_main(const std::string &config_path) {
           core::GameDB game_db;
           std::string games_csv = global::g_exe_dir + "gameList.csv";  // TODO: Get from config
           if (!game_db.load(games_csv)) {
-            Logger::instance().error("Failed to load games database: " + games_csv);
+            LOG_ERROR(MENU, "Failed to load games database: " + games_csv);
             renderer.draw_overlay("Error: Could not load games list");
             renderer.present();
             std::this_thread::sleep_for(2s);
@@ -143,7 +144,7 @@ int menu_main(const std::string &config_path) {
           if (show_games_list(renderer, games_state)) {
             // A game was selected
             const auto& selected_game = game_db.games()[games_state.selected_index];
-            Logger::instance().info("Game selected: " + 
+            LOG_INFO(MENU, "Game selected: " +
               (selected_game.name.empty() ? selected_game.path : selected_game.name));
             // TODO: Launch the selected game
           }
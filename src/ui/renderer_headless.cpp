@@ -0,0 +1,349 @@
+// src/ui/renderer_headless.cpp
+//
+// Renderer backend without a display (BUILD_TYPE=headless): frames are drawn into an
+// in-memory core::Canvas in the layout the SDL backend's screen would have
+// (platform.color_depth: RGB565 or XRGB8888) through the same pixel_convert kernels and
+// carousel layout, so a frame here matches what renderer_sdl.cpp puts on screen. Text is
+// not rasterized (as in SDL builds without HAVE_SDL_TTF).
+//
+// Draw calls are recorded into a ui::DrawList and rasterized by present(), only where they
+// changed since the previous frame.
+//
+// platform.headless_dump_dir: when set (an existing directory), present() writes every frame
+//   that changed as frame_000000.ppm, frame_000001.ppm, ...
+// platform.headless_input: comma-separated inputs poll_input() replays, one per call
+//   ("RIGHT,RIGHT,NONE,A"); once they are used up the process exits, as when the SDL
+//   window is closed. Without a script poll_input() always returns NONE.
+#include "ui/renderer.h"
+#include "ui/carousel_layout.h"
+#include "ui/draw_list.h"
+#include "core/logger.h"
+#include "core/image_cache.h"
+#include "core/image_loader.h"
+#include "core/game_db.h"
+#include "core/config_manager.h"
+#include "core/canvas.h"
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <unordered_map>
+
+using namespace ui;
+using core::Game;
+using core::ImageCache;
+
+// Covers converted to the frame's format, keyed by path@WxH; mips[path@WxH][k - 1] is mip
+// level k of that cover (what ImageCache keeps as SDL surfaces for the SDL backend)
+struct CoverStore {
+    int bpp = 32;
+    bool dither = true;
+    std::unordered_map<std::string, core::Canvas> covers;
+    std::unordered_map<std::string, std::vector<core::Canvas>> mips;
+
+    // The w x h fitted cover of `path` (converted once), or nullptr
+    const core::Canvas *get(ImageCache *cache, const std::string &path, int w, int h);
+    // The level of that cover to scale from for a dst_w x dst_h draw (get_mip_for_size)
+    const core::Canvas *get_mip(ImageCache *cache, const std::string &path, int w, int h, int dst_w, int dst_h);
+    void clear() { covers.clear(); mips.clear(); }
+};
+
+struct ui::Renderer::Impl {
+    core::Canvas frame;
+    int width = 640;
+    int height = 480;
+    bool dither = true;
+    bool initialized = false;
+    CoverStore covers;
+    // Prerendered rounded rect sprites (selector, contour), keyed by size + ShapeStyle
+    std::unordered_map<std::string, std::vector<uint32_t>> shape_cache;
+    ui::CarouselGlow glow;
+    // draw_background: the image pre-scaled to the frame in its format, and its source
+    core::Canvas background;
+    ui::BackgroundSource background_src;
+    std::string dump_dir;                 // platform.headless_dump_dir
+    unsigned long frame_no = 0;
+    // This frame's draw calls; present() rasterizes only the regions that changed
+    ui::DrawList draw_list;
+};
+
+// platform.headless_input, loaded by init(); poll_input() has no renderer to ask
+static std::vector<Input> g_script;
+static size_t g_script_pos = 0;
+
+static bool input_from_string(const std::string &name, Input &out) {
+    static const std::pair<const char*, Input> names[] = {
+        {"NONE", Input::NONE}, {"UP", Input::UP}, {"DOWN", Input::DOWN}, {"LEFT", Input::LEFT},
+        {"RIGHT", Input::RIGHT}, {"A", Input::A}, {"B", Input::B}, {"Y", Input::Y}, {"X", Input::X},
+        {"MENU", Input::MENU}, {"START", Input::START}, {"SELECT", Input::SELECT}};
+    for (const auto &n : names) {
+        if (name == n.first) { out = n.second; return true; }
+    }
+    return false;
+}
+
+static std::vector<Input> parse_script(const std::string &s) {
+    std::vector<Input> script;
+    size_t start = 0;
+    while (start <= s.size()) {
+        size_t end = s.find(',', start);
+        if (end == std::string::npos) end = s.size();
+        std::string tok = s.substr(start, end - start);
+        tok.erase(0, tok.find_first_not_of(" \t"));
+        tok.erase(tok.find_last_not_of(" \t") + 1);
+        Input in = Input::NONE;
+        if (!tok.empty()) {
+            if (input_from_string(tok, in)) script.push_back(in);
+            else LOG_ERROR(RENDER, "headless_input: unknown input '" + tok + "'");
+        }
+        start = end + 1;
+    }
+    return script;
+}
+
+namespace ui {
+
+    Input poll_input() {
+        if (g_script.empty()) return Input::NONE;
+        if (g_script_pos >= g_script.size()) {
+            LOG_INFO(RENDER, "headless input script finished");
+            exit(0);
+        }
+        return g_script[g_script_pos++];
+    }
+}
+
+void Renderer::set_config(core::ConfigManager *cfg) {
+    config_ = cfg;
+}
+
+Renderer::Renderer() : pimpl(new Impl()) {}
+Renderer::~Renderer() { shutdown(); delete pimpl; }
+
+bool Renderer::init() {
+    pimpl->width = 640;   // same mode as the SDL backend
+    pimpl->height = 480;
+
+    // platform.color_depth: 16 runs the whole frame in RGB565
+    const int depth = (config_ && config_->get<int>("platform.color_depth", 32) == 16) ? 16 : 32;
+    pimpl->frame.reset(pimpl->width, pimpl->height, depth);
+    pimpl->draw_list.set_screen(pimpl->width, pimpl->height);
+    pimpl->dither = !config_ || config_->get<bool>("platform.dither", true);
+    pimpl->covers.bpp = depth;
+    pimpl->covers.dither = pimpl->dither;
+    if (config_) {
+        pimpl->dump_dir = config_->get<std::string>("platform.headless_dump_dir", "");
+        g_script = parse_script(config_->get<std::string>("platform.headless_input", ""));
+        g_script_pos = 0;
+    }
+    pimpl->initialized = true;
+    LOG_INFO(RENDER, "headless frame " + std::to_string(pimpl->width) + "x" + std::to_string(pimpl->height) + " " +
+                     std::to_string(depth) + "bpp" + (pimpl->dump_dir.empty() ? "" : ", dumping to " + pimpl->dump_dir));
+    return true;
+}
+
+void Renderer::shutdown() {
+    pimpl->covers.clear();
+    pimpl->shape_cache.clear();
+    pimpl->background = core::Canvas();
+    pimpl->background_src.reset();
+    pimpl->draw_list.set_screen(0, 0);
+    pimpl->frame = core::Canvas();
+    pimpl->initialized = false;
+}
+
+void Renderer::clear() {
+    if (!pimpl->initialized) return;
+    core::Canvas *fb = &pimpl->frame;
+    const int w = pimpl->width, h = pimpl->height;
+    pimpl->draw_list.add(core::BlitRect{0, 0, w, h}, ui::DrawHash().add(std::string("clear")).value(),
+                         [=] { fb->fill_rect(0, 0, w, h, 10, 10, 10); });
+}
+
+void Renderer::present() {
+    if (!pimpl->initialized) return;
+    // Rasterize only the regions whose commands changed; an identical frame is not drawn
+    // (nor dumped) at all
+    const std::vector<core::BlitRect> regions = pimpl->draw_list.end_frame();
+    if (regions.empty()) return;
+    for (const core::BlitRect &r : regions) {
+        pimpl->frame.set_clip(r);
+        pimpl->draw_list.replay(r);
+    }
+    pimpl->frame.set_clip(core::BlitRect{0, 0, pimpl->width, pimpl->height});
+
+    if (!pimpl->dump_dir.empty()) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "frame_%06lu.ppm", pimpl->frame_no);
+        const std::string path = pimpl->dump_dir + "/" + name;
+        if (!pimpl->frame.write_ppm(path)) {
+            LOG_ERROR(RENDER, "could not write " + path + ", frame dumps disabled");
+            pimpl->dump_dir.clear();
+        }
+    }
+    ++pimpl->frame_no;
+}
+
+// ---------- helpers ----------
+
+// Draw a w x h ShapeStyle sprite at (x, y): rendered on first use, a single blend after
+static void draw_shape(std::unordered_map<std::string, std::vector<uint32_t>> &cache, core::Canvas &dst,
+                       int x, int y, int w, int h, const core::ShapeStyle &st) {
+    if (w <= 0 || h <= 0) return;
+    const std::string key = core::shape_key(w, h, st);
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+        if (cache.size() >= 32) cache.clear();
+        it = cache.emplace(key, core::render_shape(w, h, st)).first;
+    }
+    dst.blend_argb(it->second.data(), w * 4, w, h, x, y);
+}
+
+const core::Canvas *CoverStore::get(ImageCache *cache, const std::string &path, int w, int h) {
+    const std::string key = path + "@" + std::to_string(w) + "x" + std::to_string(h);
+    auto it = covers.find(key);
+    if (it == covers.end()) {
+        // RGBA covers are flattened onto the letterbox color; 16-bit covers are converted
+        // exactly as the SDL backend's cache surfaces (image_to_rgb565)
+        const core::ImageData img = cache->get_scaled_image(path, w, h);
+        core::Canvas c(0, 0, bpp);
+        if (bpp == 16) {
+            if (img.width <= 0 || img.height <= 0) return nullptr;
+            c.reset(img.width, img.height, 16);
+            if (!core::image_to_rgb565(img, c.data(), c.pitch(), dither, cache->letterbox_rgb())) return nullptr;
+        } else if (!c.load_image(img.pixels.data(), img.width, img.height, img.channels, dither, cache->letterbox_rgb())) {
+            return nullptr;
+        }
+        it = covers.emplace(key, std::move(c)).first;
+    }
+    return &it->second;
+}
+
+const core::Canvas *CoverStore::get_mip(ImageCache *cache, const std::string &path, int w, int h, int dst_w, int dst_h) {
+    const core::Canvas *base = get(cache, path, w, h);
+    if (!base) return nullptr;
+    const int level = core::mip_level_for(w, h, dst_w, dst_h, ImageCache::kMipLevels);
+    if (level == 0) return base;
+    std::vector<core::Canvas> &chain = mips[path + "@" + std::to_string(w) + "x" + std::to_string(h)];
+    chain.reserve(ImageCache::kMipLevels); // levels handed out stay put while the chain grows
+    while (static_cast<int>(chain.size()) < level) chain.push_back((chain.empty() ? *base : chain.back()).downsample_2x());
+    return &chain[level - 1];
+}
+
+// ---------- rendering functions ----------
+
+void Renderer::draw_background(const std::string &background_image) {
+    if (!pimpl->initialized) return;
+
+    if (pimpl->background_src.needs_reload(background_image)) {
+        pimpl->background = core::Canvas();
+        if (!background_image.empty()) {
+            core::Canvas bg(0, 0, pimpl->frame.bpp());
+            if (bg.load_file(background_image, pimpl->width, pimpl->height, core::ScaleMode::FILL, pimpl->dither)) {
+                pimpl->background = std::move(bg);
+                LOG_INFO(RENDER, "background loaded: " + background_image);
+            } else {
+                LOG_ERROR(RENDER, "background not loaded: " + background_image);
+            }
+        }
+    }
+
+    // No image: the plain clear() fill
+    if (pimpl->background.empty()) {
+        clear();
+        return;
+    }
+    core::Canvas *fb = &pimpl->frame;
+    const core::Canvas *bg = &pimpl->background;
+    pimpl->draw_list.add(core::BlitRect{0, 0, bg->width(), bg->height()}, pimpl->background_src.hash(),
+                         [=] { fb->blit(*bg, 0, 0); });
+}
+
+void Renderer::draw_text(int x, int y, const std::string &s, bool highlight) {
+    (void)x; (void)y; (void)highlight;
+    LOG_TRACE(RENDER, "[headless text] " + s);
+}
+
+void Renderer::draw_overlay(const std::string &message) {
+    if (!pimpl->initialized) return;
+    const ui::OverlayLayout o = ui::overlay_layout(pimpl->width, pimpl->height);
+    core::Canvas *fb = &pimpl->frame;
+    pimpl->draw_list.add(o.dim, o.dim_hash, [=] { fb->blend_rect(o.dim.x, o.dim.y, o.dim.w, o.dim.h, 0, 0, 0, o.dim_alpha); });
+    pimpl->draw_list.add(o.box, o.box_hash, [=] {
+        fb->blend_rect(o.box.x, o.box.y, o.box.w, o.box.h, o.box_rgb[0], o.box_rgb[1], o.box_rgb[2], o.box_alpha);
+    });
+    draw_text(o.text_x, o.text_y, message, true);
+}
+
+void Renderer::draw_button_bar(const std::string &hints) {
+    if (!pimpl->initialized || hints.empty()) return;
+    // text metrics of the SDL backend's no-font fallback
+    const ui::ButtonBarLayout l = ui::button_bar_layout(config_, pimpl->width, pimpl->height, get_text_width(hints), 16);
+    core::Canvas *fb = &pimpl->frame;
+    pimpl->draw_list.add(l.bar, l.hash, [=] {
+        fb->blend_rect(l.bar.x, l.bar.y, l.bar.w, l.bar.h, l.rgba[0], l.rgba[1], l.rgba[2], l.rgba[3]);
+    });
+    draw_text(l.text_x, l.text_y, hints, false);
+}
+
+void Renderer::draw_selector(int x, int y, int w, int h) {
+    if (!pimpl->initialized) return;
+    const core::ShapeStyle st = ui::selector_style(h);
+    const core::BlitRect r{x, y, w, h};
+    auto *cache = &pimpl->shape_cache;
+    core::Canvas *fb = &pimpl->frame;
+    pimpl->draw_list.add(r, ui::shape_hash(r, st), [=] { draw_shape(*cache, *fb, x, y, w, h, st); });
+}
+
+int Renderer::get_text_width(const std::string &s) {
+    return int(s.size() * 8);
+}
+
+void Renderer::set_sprite_layer_mode(bool enabled) {
+    // The SDL atlas only changes where covers are blitted from, not the pixels: nothing to do
+    (void)enabled;
+}
+
+void Renderer::draw_game_carousel(const std::vector<Game> &games, size_t active_index, ImageCache *cache, float scroll) {
+    if (!pimpl->initialized) return;
+
+    const ui::CarouselStyle st = ui::carousel_style(this->config_, pimpl->width, pimpl->height);
+    if (st.glow) pimpl->glow.update(st);
+
+    core::Canvas *fb = &pimpl->frame;
+    for (const ui::CarouselSlot &slot : ui::carousel_slots(games.size(), active_index, scroll, st)) {
+        const int x = slot.x, y = slot.y, w = slot.w, h = slot.h;
+
+        if (st.glow && slot.focused) {
+            const ui::GlowDraw g = pimpl->glow.draw(slot, st);
+            const uint8_t gr = st.glow_rgb[0], gg = st.glow_rgb[1], gb = st.glow_rgb[2];
+            const uint8_t *mask = pimpl->glow.mask();
+            const int pitch = pimpl->glow.mask_pitch();
+            pimpl->draw_list.add(g.rect, g.hash,
+                                 [=] { fb->blend_rect(g.rect.x, g.rect.y, g.rect.w, g.rect.h, gr, gg, gb, g.alpha, mask, pitch); });
+        }
+
+        // Prefitted sizes blit 1:1, in-between sizes scale a level of the active cover's mips
+        const std::string art_path = ui::carousel_art_path(games[slot.index]);
+        const core::Canvas *art = nullptr;
+        if (cache) {
+            art = slot.prefitted ? pimpl->covers.get(cache, art_path, w, h)
+                                 : pimpl->covers.get_mip(cache, art_path, st.active_w, st.active_h, w, h);
+        }
+
+        const ui::SlotDraw d = ui::carousel_slot_draw(slot, st, art_path, art != nullptr);
+        const core::BlitFilter filter = st.filter;
+        const core::ShapeStyle contour_style = st.contour;
+        auto *shapes = &pimpl->shape_cache;
+        pimpl->draw_list.add(d.bounds, d.hash, [=] {
+            const core::BlitRect &b = d.bounds;
+            fb->fill_rect(b.x, b.y, b.w, b.h, ui::kCarouselFrameRgb[0], ui::kCarouselFrameRgb[1], ui::kCarouselFrameRgb[2]);
+            if (art) fb->blit_scaled(*art, core::BlitRect{x, y, w, h}, filter);
+            else fb->fill_rect(x, y, w, h, d.placeholder[0], d.placeholder[1], d.placeholder[2]);
+            if (d.contour) draw_shape(*shapes, *fb, b.x, b.y, b.w, b.h, contour_style);
+        });
+
+        draw_text(d.label_x, d.label_y, ui::game_label(games[slot.index]), slot.focused);
+    }
+}
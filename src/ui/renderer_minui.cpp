@@ -9,7 +9,6 @@
 using namespace ui;
 using core::Game;
 using core::ImageCache;
-using core::Logger;
 
 struct ui::Renderer::Impl {
     int dummy = 0;
@@ -24,16 +23,20 @@ void Renderer::clear() {}
 void Renderer::present() {}
 
 void Renderer::draw_background(const std::string &background_image) {
-    Logger::instance().info(std::string("[minui] draw_background ") + background_image);
+    LOG_TRACE(RENDER, "[minui] draw_background " + background_image);
 }
 
 void Renderer::draw_text(int x, int y, const std::string &s, bool highlight) {
     (void)x; (void)y; (void)highlight;
-    Logger::instance().info(std::string("[minui text] ") + s);
+    LOG_TRACE(RENDER, "[minui text] " + s);
 }
 
 void Renderer::draw_overlay(const std::string &message) {
-    Logger::instance().info(std::string("[minui overlay] ") + message);
+    LOG_TRACE(RENDER, "[minui overlay] " + message);
+}
+
+void Renderer::draw_button_bar(const std::string &hints) {
+    LOG_TRACE(RENDER, "[minui buttons] " + hints);
 }
 
 void Renderer::set_sprite_layer_mode(bool enabled) {
@@ -41,9 +44,9 @@ void Renderer::set_sprite_layer_mode(bool enabled) {
 }
 
 void Renderer::draw_selector(int x, int y, int w, int h) {
-    Logger::instance().info(std::string("[minui selector] x=") + std::to_string(x) +
-                            " y=" + std::to_string(y) + " w=" + std::to_string(w) +
-                            " h=" + std::to_string(h));
+    LOG_TRACE(RENDER, "[minui selector] x=" + std::to_string(x) +
+                      " y=" + std::to_string(y) + " w=" + std::to_string(w) +
+                      " h=" + std::to_string(h));
 }
 
 int Renderer::get_text_width(const std::string &s) {
@@ -51,10 +54,11 @@ int Renderer::get_text_width(const std::string &s) {
     return int(s.size() * 8);
 }
 
-void Renderer::draw_game_carousel(const std::vector<Game> &games, size_t active_index, ImageCache *cache) {
+void Renderer::draw_game_carousel(const std::vector<Game> &games, size_t active_index, ImageCache *cache, float scroll) {
     (void)cache;
+    (void)scroll;
     for (size_t i = 0; i < games.size(); ++i) {
-        if (i == active_index) Logger::instance().info(std::string("[minui active] ") + games[i].title);
-        else Logger::instance().info(std::string("[minui slot]   ") + games[i].title);
+        if (i == active_index) LOG_TRACE(RENDER, "[minui active] " + games[i].name);
+        else LOG_TRACE(RENDER, "[minui slot]   " + games[i].name);
     }
 }
@@ -1,6 +1,6 @@
 // src/ui/renderer_sdl.cpp
 // SDL 1.2 renderer for sliderUI — rounded selector pill + correct text colors
-// Fixed: draw_solid_pill draws both semicircles, and top highlight clipped to pill.
+// Selector pill and contour outlines are antialiased sprites, rendered once per shape.
 
 #include "core/global.h"
 #include "ui/renderer.h"
@@ -8,6 +8,12 @@
 #include "core/image_cache.h"
 #include "core/game_db.h"
 #include "core/config_manager.h"
+#include "core/atlas_packer.h"
+#include "core/pixel_convert.h"
+#include "core/canvas.h"
+#include "ui/carousel_layout.h"
+#include "ui/draw_list.h"
+#include "core/image_loader.h"
 
 #include <SDL/SDL.h>
 #ifdef HAVE_SDL_TTF
@@ -16,53 +22,48 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <cmath>
+#include <cstdlib>
 #include <unordered_map>
 #include <iostream>
 
 using namespace ui;
 using core::ImageCache;
 using core::Game;
-using core::Logger;
+
+#ifdef HAVE_SDL_TTF
+// A rendered label in display format
+struct TextSprite {
+    SDL_Surface *shadow = nullptr;
+    SDL_Surface *text = nullptr;
+};
+#endif
 
 struct ui::Renderer::Impl {
     SDL_Surface *screen = nullptr;
 #ifdef HAVE_SDL_TTF
     TTF_Font *font = nullptr;
+    // Rendered labels, keyed by highlight flag + text
+    std::unordered_map<std::string, TextSprite> text_cache;
 #endif
     int width = 800;
     int height = 480;
     bool sprite_layer_mode = false;
-    SDL_Surface *sprite_atlas = nullptr;
-    std::unordered_map<std::string, SDL_Rect> atlas_map;
+    SDL_Surface *sprite_atlas = nullptr;  // long-lived, screen format; covers are uploaded once
+    core::AtlasPacker atlas_packer;       // atlas layout, keyed by art_path@WxH
+    SDL_Surface *scale_scratch = nullptr; // blit_scaled staging for covers not in screen format
+    // Prerendered rounded rect sprites (selector, contour), keyed by size + ShapeStyle
+    std::unordered_map<std::string, SDL_Surface*> shape_cache;
+    ui::CarouselGlow glow;
+    // draw_background: the image pre-scaled to the screen in its format, and its source
+    SDL_Surface *background = nullptr;
+    ui::BackgroundSource background_src;
+    // This frame's draw calls; present() rasterizes only the regions that changed
+    ui::DrawList draw_list;
 };
 
-static std::string basename_from_path(const std::string &p) {
-    if (p.empty()) return std::string();
-    auto pos = p.find_last_of("/\\");
-    if (pos == std::string::npos) return p;
-    return p.substr(pos + 1);
-}
-
-static std::string find_art_for_game(const Game &g) {
-    std::string label = g.name.empty() ? basename_from_path(g.path) : g.name;
-
-    // sanitize spaces etc. if your filesystem needs it (optional)
-    // std::replace(label.begin(), label.end(), ' ', '_');
-
-    const std::vector<std::string> exts = {".png", ".jpg", ".jpeg", ".webp"};
-    std::string base = global::g_exe_dir + "assets/img/" + label;
-
-    for (const auto &ext : exts) {
-        std::string full = base + ext;
-        FILE *f = fopen(full.c_str(), "rb");
-        if (f) { fclose(f); return full; }
-    }
-
-    return std::string(); // not found
-}
-
 namespace ui {
     
     Input poll_input() {
@@ -101,22 +102,27 @@ Renderer::~Renderer() { shutdown(); delete pimpl; }
 
 bool Renderer::init() {
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) != 0) {
-        Logger::instance().error(std::string("SDL_Init failed: ") + SDL_GetError());
+        LOG_ERROR(RENDER, std::string("SDL_Init failed: ") + SDL_GetError());
         return false;
     }
 
     pimpl->width = 640;   // match old behavior
     pimpl->height = 480;
 
-    pimpl->screen = SDL_SetVideoMode(pimpl->width, pimpl->height, 32, SDL_SWSURFACE | SDL_DOUBLEBUF);
+    // platform.color_depth: 16 runs the whole frame in RGB565 (screen, cached covers, atlas)
+    const int depth = (config_ && config_->get<int>("platform.color_depth", 32) == 16) ? 16 : 32;
+    pimpl->screen = SDL_SetVideoMode(pimpl->width, pimpl->height, depth, SDL_SWSURFACE | SDL_DOUBLEBUF);
     if (!pimpl->screen) {
-        Logger::instance().error(std::string("SDL_SetVideoMode failed: ") + SDL_GetError());
+        LOG_ERROR(RENDER, std::string("SDL_SetVideoMode failed: ") + SDL_GetError());
         return false;
     }
+    LOG_INFO(RENDER, "video mode " + std::to_string(pimpl->width) + "x" + std::to_string(pimpl->height) + " " +
+                     std::to_string(pimpl->screen->format->BitsPerPixel) + "bpp");
+    pimpl->draw_list.set_screen(pimpl->width, pimpl->height);
 
 #ifdef HAVE_SDL_TTF
 if (TTF_Init() == -1) {
-    Logger::instance().error(std::string("TTF_Init failed: ") + TTF_GetError());
+    LOG_ERROR(RENDER, std::string("TTF_Init failed: ") + TTF_GetError());
     pimpl->font = nullptr;
 } else {
 
@@ -131,13 +137,13 @@ if (TTF_Init() == -1) {
     for (const auto& path : try_paths) {
         pimpl->font = TTF_OpenFont(path.c_str(), 28);
         if (pimpl->font) {
-            Logger::instance().info("Loaded font: " + path);
+            LOG_INFO(RENDER, "Loaded font: " + path);
             break;
         }
     }
 
     if (!pimpl->font) {
-        Logger::instance().error("Could not load any font. Text will be invisible.");
+        LOG_ERROR(RENDER, "Could not load any font. Text will be invisible.");
     }
 }
 #endif
@@ -145,16 +151,43 @@ if (TTF_Init() == -1) {
     return true;
 }
 
+static void clear_shape_cache(std::unordered_map<std::string, SDL_Surface*> &cache) {
+    for (auto &e : cache) SDL_FreeSurface(e.second);
+    cache.clear();
+}
+
+#ifdef HAVE_SDL_TTF
+static void clear_text_cache(std::unordered_map<std::string, TextSprite> &cache) {
+    for (auto &e : cache) {
+        if (e.second.shadow) SDL_FreeSurface(e.second.shadow);
+        if (e.second.text) SDL_FreeSurface(e.second.text);
+    }
+    cache.clear();
+}
+#endif
+
 void Renderer::shutdown() {
+    clear_shape_cache(pimpl->shape_cache);
 #ifdef HAVE_SDL_TTF
+    clear_text_cache(pimpl->text_cache);
     if (pimpl->font) { TTF_CloseFont(pimpl->font); pimpl->font = nullptr; }
     TTF_Quit();
 #endif
     if (pimpl->sprite_atlas) {
         SDL_FreeSurface(pimpl->sprite_atlas);
         pimpl->sprite_atlas = nullptr;
-        pimpl->atlas_map.clear();
+        pimpl->atlas_packer.reset(0, 0);
+    }
+    if (pimpl->scale_scratch) {
+        SDL_FreeSurface(pimpl->scale_scratch);
+        pimpl->scale_scratch = nullptr;
+    }
+    if (pimpl->background) {
+        SDL_FreeSurface(pimpl->background);
+        pimpl->background = nullptr;
+        pimpl->background_src.reset();
     }
+    pimpl->draw_list.set_screen(0, 0);
     if (pimpl->screen) {
         SDL_FreeSurface(pimpl->screen);
         pimpl->screen = nullptr;
@@ -162,18 +195,37 @@ void Renderer::shutdown() {
     SDL_Quit();
 }
 
+// Draw calls are recorded into pimpl->draw_list (bounds, hash of what they draw, and the
+// rasterization itself) and run by present() for the regions that changed.
+
 void Renderer::clear() {
     if (!pimpl->screen) return;
-    SDL_FillRect(pimpl->screen, nullptr, SDL_MapRGB(pimpl->screen->format, 10, 10, 10));
+    SDL_Surface *screen = pimpl->screen;
+    pimpl->draw_list.add(core::BlitRect{0, 0, pimpl->width, pimpl->height}, ui::DrawHash().add(std::string("clear")).value(),
+                         [screen] { SDL_FillRect(screen, nullptr, SDL_MapRGB(screen->format, 10, 10, 10)); });
 }
 
 void Renderer::present() {
     if (!pimpl->screen) return;
-    SDL_Flip(pimpl->screen);
-}
+    // Rasterize only the regions whose commands changed since the last frame; an identical
+    // frame costs neither drawing nor a flip
+    const std::vector<core::BlitRect> regions = pimpl->draw_list.end_frame();
+    if (regions.empty()) return;
+
+    // A page-flipped screen holds an older frame in its back buffer: redraw all of it
+    const bool flipping = (pimpl->screen->flags & SDL_HWSURFACE) && (pimpl->screen->flags & SDL_DOUBLEBUF);
+    std::vector<SDL_Rect> rects;
+    for (const core::BlitRect &r : flipping ? std::vector<core::BlitRect>{{0, 0, pimpl->width, pimpl->height}} : regions) {
+        SDL_Rect clip = {static_cast<Sint16>(r.x), static_cast<Sint16>(r.y), static_cast<Uint16>(r.w), static_cast<Uint16>(r.h)};
+        SDL_SetClipRect(pimpl->screen, &clip);
+        pimpl->draw_list.replay(r);
+        rects.push_back(clip);
+    }
+    SDL_SetClipRect(pimpl->screen, nullptr);
+    LOG_TRACE(RENDER, "present: " + std::to_string(regions.size()) + " changed region(s)");
 
-void Renderer::draw_background(const std::string &background_image) {
-    (void)background_image;
+    if (flipping) SDL_Flip(pimpl->screen);
+    else SDL_UpdateRects(pimpl->screen, static_cast<int>(rects.size()), rects.data());
 }
 
 // ---------- helpers ----------
@@ -205,127 +257,245 @@ static void draw_filled_rect(SDL_Surface *dst, int x, int y, int w, int h, Uint8
     fill_rect(dst, x, y, w, h, r, g, b);
 }
 
-// draw a solid rounded pill by horizontal spans (central rect + both semicircles)
-static void draw_solid_pill(SDL_Surface *dst, int x, int y, int w, int h, Uint8 r, Uint8 g, Uint8 b) {
-    if (!dst || w <= 0 || h <= 0) return;
-    int radius = h / 2;
-    if (radius < 1) radius = 1;
-
-    // central rect
-    int inner_x = x + radius;
-    int inner_w = w - 2 * radius;
-    if (inner_w > 0) {
-        fill_rect(dst, inner_x, y, inner_w, h, r, g, b);
+// Intersect (x, y, w, h) with dst's clip rect; false when nothing is left
+static bool clip_to_surface(const SDL_Surface *dst, int &x, int &y, int &w, int &h) {
+    const SDL_Rect &c = dst->clip_rect;
+    const int x1 = std::min(x + w, c.x + c.w);
+    const int y1 = std::min(y + h, c.y + c.h);
+    x = std::max<int>(x, c.x);
+    y = std::max<int>(y, c.y);
+    w = x1 - x;
+    h = y1 - y;
+    return w > 0 && h > 0;
+}
+
+static bool is_rgb565(const SDL_PixelFormat *f) {
+    return f->BytesPerPixel == 2 && f->Rmask == 0xF800 && f->Gmask == 0x07E0 && f->Bmask == 0x001F;
+}
+
+// 32 bpp with every color channel in a whole byte: the blend kernels mix byte lanes
+static bool is_byte_rgb(const SDL_PixelFormat *f) {
+    auto whole_byte = [](Uint32 m) { return m == 0xFF || m == 0xFF00 || m == 0xFF0000 || m == 0xFF000000u; };
+    return f->BytesPerPixel == 4 && whole_byte(f->Rmask) && whole_byte(f->Gmask) && whole_byte(f->Bmask);
+}
+
+// Blend color (r, g, b) at alpha `a` over a rect of dst (core::blend_color_32/565).
+// `mask`, if given, holds per-pixel coverage for the unclipped w x h rect; it is scaled by `a`.
+// Layouts the kernels don't cover fall back to an opaque fill above half alpha.
+static void blend_rect(SDL_Surface *dst, int x, int y, int w, int h, Uint8 r, Uint8 g, Uint8 b, Uint8 a,
+                       const Uint8 *mask = nullptr, int mask_pitch = 0) {
+    if (!dst || a == 0) return;
+    const int x0 = x, y0 = y;
+    if (!clip_to_surface(dst, x, y, w, h)) return;
+    const SDL_PixelFormat *f = dst->format;
+    if (!is_byte_rgb(f) && !is_rgb565(f)) {
+        if (!mask && a >= 128) fill_rect(dst, x, y, w, h, r, g, b);
+        return;
     }
+    if (mask) mask += static_cast<size_t>(y - y0) * mask_pitch + (x - x0);
+    if (SDL_MUSTLOCK(dst)) SDL_LockSurface(dst);
+    Uint8 *p = static_cast<Uint8*>(dst->pixels) + static_cast<size_t>(y) * dst->pitch + x * f->BytesPerPixel;
+    const Uint32 pixel = SDL_MapRGB(f, r, g, b);
+    if (f->BytesPerPixel == 4) core::blend_color_32(p, dst->pitch, w, h, pixel, a, mask, mask_pitch);
+    else core::blend_color_565(p, dst->pitch, w, h, static_cast<uint16_t>(pixel), a, mask, mask_pitch);
+    if (SDL_MUSTLOCK(dst)) SDL_UnlockSurface(dst);
+}
 
-    int cy = y + h / 2;
-
-    // left semicircle
-    int cx_left = x + radius;
-    for (int dy = -radius; dy <= radius; ++dy) {
-        int absdy = std::abs(dy);
-        if (absdy > radius) continue;
-        int dx = static_cast<int>(std::floor(std::sqrt(double(radius*radius - absdy*absdy))));
-        int sx = cx_left - dx;
-        int span = dx * 2 + 1;
-        fill_rect(dst, sx, cy + dy, span, 1, r, g, b);
+// Blit a per-pixel-alpha surface (text sprites from SDL_DisplayFormatAlpha) at (x, y).
+// ARGB8888 sources over a matching 32 bpp or an RGB565 screen go through
+// core::blend_argb_32/565; everything else is left to SDL_BlitSurface.
+static void blit_alpha(SDL_Surface *src, SDL_Surface *dst, int x, int y) {
+    if (!src || !dst) return;
+    const SDL_PixelFormat *sf = src->format, *df = dst->format;
+    const bool argb = sf->BytesPerPixel == 4 && sf->Amask == 0xFF000000u && (src->flags & SDL_SRCALPHA);
+    const bool to32 = argb && is_byte_rgb(df) && df->Rmask == sf->Rmask && df->Gmask == sf->Gmask && df->Bmask == sf->Bmask;
+    const bool to565 = argb && is_rgb565(df) && sf->Rmask == 0xFF0000 && sf->Gmask == 0xFF00 && sf->Bmask == 0xFF;
+    if (!to32 && !to565) {
+        SDL_Rect d = {static_cast<Sint16>(x), static_cast<Sint16>(y), static_cast<Uint16>(src->w), static_cast<Uint16>(src->h)};
+        SDL_BlitSurface(src, nullptr, dst, &d);
+        return;
     }
+    int cx = x, cy = y, w = src->w, h = src->h;
+    if (!clip_to_surface(dst, cx, cy, w, h)) return;
+    if (SDL_MUSTLOCK(src)) SDL_LockSurface(src);
+    if (SDL_MUSTLOCK(dst)) SDL_LockSurface(dst);
+    const Uint8 *sp = static_cast<const Uint8*>(src->pixels) + static_cast<size_t>(cy - y) * src->pitch + (cx - x) * 4;
+    Uint8 *dp = static_cast<Uint8*>(dst->pixels) + static_cast<size_t>(cy) * dst->pitch + cx * df->BytesPerPixel;
+    if (to32) core::blend_argb_32(sp, src->pitch, dp, dst->pitch, w, h);
+    else core::blend_argb_565(sp, src->pitch, dp, dst->pitch, w, h);
+    if (SDL_MUSTLOCK(dst)) SDL_UnlockSurface(dst);
+    if (SDL_MUSTLOCK(src)) SDL_UnlockSurface(src);
+}
 
-    // right semicircle
-    int cx_right = x + w - radius;
-    for (int dy = -radius; dy <= radius; ++dy) {
-        int absdy = std::abs(dy);
-        if (absdy > radius) continue;
-        int dx = static_cast<int>(std::floor(std::sqrt(double(radius*radius - absdy*absdy))));
-        int sx = cx_right - dx;
-        int span = dx * 2 + 1;
-        fill_rect(dst, sx, cy + dy, span, 1, r, g, b);
+// ShapeStyle sprite (core::render_shape) as an SDL surface in display format for blit_alpha
+static SDL_Surface *shape_surface(int w, int h, const core::ShapeStyle &st) {
+    SDL_Surface *surf = SDL_CreateRGBSurface(SDL_SWSURFACE | SDL_SRCALPHA, w, h, 32,
+                                             0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000u);
+    if (!surf) return nullptr;
+    const std::vector<uint32_t> argb = core::render_shape(w, h, st);
+    if (SDL_MUSTLOCK(surf)) SDL_LockSurface(surf);
+    for (int y = 0; y < h; ++y) {
+        std::memcpy(static_cast<Uint8*>(surf->pixels) + static_cast<size_t>(y) * surf->pitch,
+                    argb.data() + static_cast<size_t>(y) * w, static_cast<size_t>(w) * 4);
+    }
+    if (SDL_MUSTLOCK(surf)) SDL_UnlockSurface(surf);
+    if (SDL_Surface *conv = SDL_DisplayFormatAlpha(surf)) {
+        SDL_FreeSurface(surf);
+        return conv;
     }
+    return surf;
 }
 
-// Draw a horizontal 1px line that is clipped to the pill outline (so it won't show outside rounded corners)
-// y_line is absolute y coordinate where the 1px line should be drawn
-static void draw_pill_hline(SDL_Surface *dst, int x, int y, int w, int h, int y_line, Uint8 r, Uint8 g, Uint8 b) {
+// Draw a w x h ShapeStyle sprite at (x, y): rendered on first use, a single blit after
+static void draw_shape(std::unordered_map<std::string, SDL_Surface*> &cache, SDL_Surface *dst,
+                       int x, int y, int w, int h, const core::ShapeStyle &st) {
     if (!dst || w <= 0 || h <= 0) return;
-    int radius = h / 2;
-    if (radius < 1) radius = 1;
-    int cy = y + h / 2;
+    const std::string key = core::shape_key(w, h, st);
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+        if (cache.size() >= 32) clear_shape_cache(cache);
+        SDL_Surface *sprite = shape_surface(w, h, st);
+        if (!sprite) return;
+        it = cache.emplace(key, sprite).first;
+    }
+    blit_alpha(it->second, dst, x, y);
+}
 
-    int inner_x = x + radius;
-    int inner_w = w - 2 * radius;
+#ifdef HAVE_SDL_TTF
+// The shadow and text sprites of label `s`: rendered once and kept in display format
+// (SDL_DisplayFormatAlpha: ARGB8888 matching the screen's channel order, which is what
+// blit_alpha's kernels expect)
+static const TextSprite *text_sprite(TTF_Font *font, std::unordered_map<std::string, TextSprite> &cache,
+                                     const std::string &s, bool highlight) {
+    const std::string key = (highlight ? "1" : "0") + s;
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+        if (cache.size() >= 128) clear_text_cache(cache);
+        // Colors: selected -> white; unselected -> light gray
+        SDL_Color fg;
+        if (highlight) { fg.r = 255; fg.g = 255; fg.b = 255; fg.unused = 0; }
+        else           { fg.r = 200; fg.g = 200; fg.b = 200; fg.unused = 0; }
+
+        SDL_Color shadow;
+        shadow.r = 0; shadow.g = 0; shadow.b = 0; shadow.unused = 0;
+
+        auto to_display = [](SDL_Surface *raw) -> SDL_Surface* {
+            if (!raw) return nullptr;
+            SDL_Surface *conv = SDL_DisplayFormatAlpha(raw);
+            if (!conv) return raw;
+            SDL_FreeSurface(raw);
+            return conv;
+        };
+        TextSprite sprite;
+        sprite.shadow = to_display(TTF_RenderUTF8_Blended(font, s.c_str(), shadow));
+        sprite.text = to_display(TTF_RenderUTF8_Blended(font, s.c_str(), fg));
+        it = cache.emplace(key, sprite).first;
+    }
+    return &it->second;
+}
+#endif
 
-    int dy = y_line - cy;
-    if (std::abs(dy) > radius) return; // outside pill
+// ---------- rendering functions ----------
 
-    // draw central area if it exists
-    if (inner_w > 0) {
-        fill_rect(dst, inner_x, y_line, inner_w, 1, r, g, b);
+// Decode `path`, fill it over a w x h screen (aspect kept, center-cropped) and convert it to
+// the screen's pixel format once, so drawing it is a plain row copy. nullptr on failure.
+static SDL_Surface *load_background(SDL_Surface *screen, const std::string &path, int w, int h, bool dither) {
+    const SDL_PixelFormat *f = screen->format;
+    // decoded straight into the screen layout when core::Canvas has it (RGB565 / XRGB8888)
+    const bool xrgb = f->BitsPerPixel == 32 && f->Rmask == 0xFF0000 && f->Gmask == 0xFF00 && f->Bmask == 0xFF;
+    core::Canvas canvas(0, 0, is_rgb565(f) ? 16 : 32);
+    if (!canvas.load_file(path, w, h, core::ScaleMode::FILL, dither)) return nullptr;
+
+    SDL_Surface *surf = SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, f->BitsPerPixel, f->Rmask, f->Gmask, f->Bmask, 0);
+    if (!surf) return nullptr;
+    if (SDL_MUSTLOCK(surf)) SDL_LockSurface(surf);
+    for (int y = 0; y < h; ++y) {
+        Uint8 *row = static_cast<Uint8*>(surf->pixels) + static_cast<size_t>(y) * surf->pitch;
+        if (is_rgb565(f) || xrgb) {
+            std::memcpy(row, canvas.data() + static_cast<size_t>(y) * canvas.pitch(), static_cast<size_t>(canvas.pitch()));
+        } else {
+            for (int x = 0; x < w; ++x) {
+                Uint8 r, g, b;
+                canvas.get_rgb(x, y, r, g, b);
+                const Uint32 px = SDL_MapRGB(surf->format, r, g, b);
+                std::memcpy(row + x * f->BytesPerPixel, &px, f->BytesPerPixel); // 2/4 bpp little endian
+            }
+        }
     }
-
-    // left cap
-    int dx_left = static_cast<int>(std::floor(std::sqrt(double(radius*radius - dy*dy))));
-    int lx = (x + radius) - dx_left;
-    int lspan = dx_left * 2 + 1;
-    // Clip to leftmost central boundary so we don't overdrawing overlap is harmless but we clip anyway.
-    fill_rect(dst, lx, y_line, lspan, 1, r, g, b);
-
-    // right cap
-    int dx_right = dx_left; // symmetric
-    int rx = (x + w - radius) - dx_right;
-    int rspan = dx_right * 2 + 1;
-    fill_rect(dst, rx, y_line, rspan, 1, r, g, b);
+    if (SDL_MUSTLOCK(surf)) SDL_UnlockSurface(surf);
+    return surf;
 }
 
-// Draw rounded pill by composing border (outer) and inner fill (inset by 1 px).
-static void draw_rounded_pill(SDL_Surface *dst, int x, int y, int w, int h,
-                              Uint8 r, Uint8 g, Uint8 b, Uint8 br, Uint8 bg, Uint8 bb) {
-    if (!dst || w <= 0 || h <= 0) return;
+void Renderer::draw_background(const std::string &background_image) {
+    if (!pimpl->screen) return;
 
-    // Outer pill = border
-    draw_solid_pill(dst, x, y, w, h, br, bg, bb);
-
-    // Inner pill inset
-    const int inset = 1;
-    int ix = x + inset;
-    int iy = y + inset;
-    int iw = w - 2 * inset;
-    int ih = h - 2 * inset;
-    if (iw > 0 && ih > 0) {
-        draw_solid_pill(dst, ix, iy, iw, ih, r, g, b);
+    if (pimpl->background_src.needs_reload(background_image)) {
+        if (pimpl->background) SDL_FreeSurface(pimpl->background);
+        pimpl->background = nullptr;
+        if (!background_image.empty()) {
+            const bool dither = !config_ || config_->get<bool>("platform.dither", true);
+            pimpl->background = load_background(pimpl->screen, background_image, pimpl->width, pimpl->height, dither);
+            if (pimpl->background) LOG_INFO(RENDER, "background loaded: " + background_image);
+            else LOG_ERROR(RENDER, "background not loaded: " + background_image);
+        }
     }
-}
 
-// ---------- rendering functions ----------
+    // No image: the plain clear() fill
+    SDL_Surface *bg = pimpl->background;
+    if (!bg) {
+        clear();
+        return;
+    }
+    SDL_Surface *screen = pimpl->screen;
+    SDL_Surface **current = &pimpl->background;
+    pimpl->draw_list.add(core::BlitRect{0, 0, bg->w, bg->h}, pimpl->background_src.hash(), [screen, current] {
+        // Same format and size as the screen: copy the clipped rows (one memcpy when the
+        // whole screen is drawn and the pitches match)
+        const SDL_Surface *bg = *current;
+        if (!bg) return;
+        const SDL_Rect &c = screen->clip_rect;
+        const int bpp = bg->format->BytesPerPixel;
+        const int x1 = std::min<int>(c.x + c.w, bg->w), y1 = std::min<int>(c.y + c.h, bg->h);
+        if (x1 <= c.x || y1 <= c.y) return;
+        if (SDL_MUSTLOCK(screen)) SDL_LockSurface(screen);
+        Uint8 *dst = static_cast<Uint8*>(screen->pixels);
+        const Uint8 *src = static_cast<const Uint8*>(bg->pixels);
+        if (bg->pitch == screen->pitch && c.x == 0 && x1 == bg->w) {
+            std::memcpy(dst + static_cast<size_t>(c.y) * bg->pitch, src + static_cast<size_t>(c.y) * bg->pitch,
+                        static_cast<size_t>(bg->pitch) * (y1 - c.y));
+        } else {
+            const size_t row = static_cast<size_t>(x1 - c.x) * bpp;
+            for (int y = c.y; y < y1; ++y)
+                std::memcpy(dst + static_cast<size_t>(y) * screen->pitch + c.x * bpp,
+                            src + static_cast<size_t>(y) * bg->pitch + c.x * bpp, row);
+        }
+        if (SDL_MUSTLOCK(screen)) SDL_UnlockSurface(screen);
+    });
+}
 
 void Renderer::draw_text(int x, int y, const std::string &s, bool highlight) {
 #ifdef HAVE_SDL_TTF
-    if (!pimpl->font || !pimpl->screen) return;
-
-    // Colors: selected -> white; unselected -> light gray
-    SDL_Color fg;
-    if (highlight) { fg.r = 255; fg.g = 255; fg.b = 255; fg.unused = 0; }
-    else           { fg.r = 200; fg.g = 200; fg.b = 200; fg.unused = 0; }
-
-    SDL_Color shadow;
-    shadow.r = 0; shadow.g = 0; shadow.b = 0; shadow.unused = 0;
-
-    // Shadow (offset 2,2)
-    SDL_Surface *shadow_surf = TTF_RenderUTF8_Blended(pimpl->font, s.c_str(), shadow);
-    if (shadow_surf) {
-        SDL_Rect dst{ static_cast<Sint16>(x + 2), static_cast<Sint16>(y + 2),
-                      static_cast<Uint16>(shadow_surf->w), static_cast<Uint16>(shadow_surf->h) };
-        SDL_BlitSurface(shadow_surf, nullptr, pimpl->screen, &dst);
-        SDL_FreeSurface(shadow_surf);
+    if (!pimpl->font || !pimpl->screen || s.empty()) return;
+    // The sprite is made now for its size; the command looks it up again when it runs, as
+    // text_cache may have been flushed in between
+    const TextSprite *sprite = text_sprite(pimpl->font, pimpl->text_cache, s, highlight);
+    if (!sprite || !sprite->text) return;
+    int w = sprite->text->w, h = sprite->text->h;
+    if (sprite->shadow) {
+        w = std::max(w, sprite->shadow->w + 2);
+        h = std::max(h, sprite->shadow->h + 2);
     }
-
-    // Main text
-    SDL_Surface *surf = TTF_RenderUTF8_Blended(pimpl->font, s.c_str(), fg);
-    if (!surf) return;
-    SDL_Rect dst{ static_cast<Sint16>(x), static_cast<Sint16>(y),
-                  static_cast<Uint16>(surf->w), static_cast<Uint16>(surf->h) };
-
-    SDL_BlitSurface(surf, nullptr, pimpl->screen, &dst);
-    SDL_FreeSurface(surf);
+    const uint64_t hash = ui::DrawHash().add(std::string("text")).add(x).add(y).add(s).add(int(highlight)).value();
+    TTF_Font *font = pimpl->font;
+    auto *cache = &pimpl->text_cache;
+    SDL_Surface *screen = pimpl->screen;
+    pimpl->draw_list.add(core::BlitRect{x, y, w, h}, hash, [=] {
+        const TextSprite *t = text_sprite(font, *cache, s, highlight);
+        if (!t) return;
+        // Shadow (offset 2,2), then the text; both alpha-blended by blit_alpha
+        blit_alpha(t->shadow, screen, x + 2, y + 2);
+        blit_alpha(t->text, screen, x, y);
+    });
 #else
     (void)x; (void)y; (void)s; (void)highlight;
 #endif
@@ -333,35 +503,38 @@ void Renderer::draw_text(int x, int y, const std::string &s, bool highlight) {
 
 void Renderer::draw_overlay(const std::string &message) {
     if (!pimpl->screen) return;
-    int w = pimpl->width - 100;
-    int h = 160;
-    int x = 50;
-    int y = (pimpl->height - h) / 2;
-    // dark background
-    fill_rect(pimpl->screen, x, y, w, h, 12, 12, 12);
-    draw_text(x + 12, y + 12, message, true);
+    const ui::OverlayLayout o = ui::overlay_layout(pimpl->width, pimpl->height);
+    SDL_Surface *screen = pimpl->screen;
+    pimpl->draw_list.add(o.dim, o.dim_hash,
+                         [=] { blend_rect(screen, o.dim.x, o.dim.y, o.dim.w, o.dim.h, 0, 0, 0, o.dim_alpha); });
+    pimpl->draw_list.add(o.box, o.box_hash, [=] {
+        blend_rect(screen, o.box.x, o.box.y, o.box.w, o.box.h, o.box_rgb[0], o.box_rgb[1], o.box_rgb[2], o.box_alpha);
+    });
+    draw_text(o.text_x, o.text_y, message, true);
+}
+
+void Renderer::draw_button_bar(const std::string &hints) {
+    if (!pimpl->screen || hints.empty()) return;
+    int text_w = get_text_width(hints);
+    int text_h = 16;
+#ifdef HAVE_SDL_TTF
+    if (pimpl->font) TTF_SizeUTF8(pimpl->font, hints.c_str(), &text_w, &text_h);
+#endif
+    const ui::ButtonBarLayout l = ui::button_bar_layout(config_, pimpl->width, pimpl->height, text_w, text_h);
+    SDL_Surface *screen = pimpl->screen;
+    pimpl->draw_list.add(l.bar, l.hash, [=] {
+        blend_rect(screen, l.bar.x, l.bar.y, l.bar.w, l.bar.h, l.rgba[0], l.rgba[1], l.rgba[2], l.rgba[3]);
+    });
+    draw_text(l.text_x, l.text_y, hints, false);
 }
 
 void Renderer::draw_selector(int x, int y, int w, int h) {
     if (!pimpl->screen) return;
-    // Gray pill fill + darker border
-    Uint8 fill_r = 96;
-    Uint8 fill_g = 96;
-    Uint8 fill_b = 96;
-    Uint8 border_r = 60;
-    Uint8 border_g = 60;
-    Uint8 border_b = 60;
-
-    // Draw border + inner fill (no square border artifact)
-    draw_rounded_pill(pimpl->screen, x, y, w, h, fill_r, fill_g, fill_b, border_r, border_g, border_b);
-
-    // subtle top highlight inside inner area (inset so it follows rounded edge)
-    int hi_inset = 2;
-    int hi_y = y + hi_inset;
-    Uint8 hr = static_cast<Uint8>(std::min<int>(255, fill_r + 20));
-    Uint8 hg = static_cast<Uint8>(std::min<int>(255, fill_g + 20));
-    Uint8 hb = static_cast<Uint8>(std::min<int>(255, fill_b + 20));
-    draw_pill_hline(pimpl->screen, x + 1, y + 1, w - 2, h - 2, hi_y, hr, hg, hb);
+    const core::ShapeStyle st = ui::selector_style(h);
+    const core::BlitRect r{x, y, w, h};
+    auto *cache = &pimpl->shape_cache;
+    SDL_Surface *screen = pimpl->screen;
+    pimpl->draw_list.add(r, ui::shape_hash(r, st), [=] { draw_shape(*cache, screen, x, y, w, h, st); });
 }
 
 int Renderer::get_text_width(const std::string &s) {
@@ -380,186 +553,176 @@ void Renderer::set_sprite_layer_mode(bool enabled) {
     if (!enabled && pimpl->sprite_atlas) {
         SDL_FreeSurface(pimpl->sprite_atlas);
         pimpl->sprite_atlas = nullptr;
-        pimpl->atlas_map.clear();
+        pimpl->atlas_packer.reset(0, 0);
     }
 }
 
-static SDL_Surface *build_atlas(SDL_Surface *screen, const std::vector<std::pair<std::string, SDL_Surface*>> &imgs,
-                                std::unordered_map<std::string, SDL_Rect> &out_map) {
-    if (imgs.empty() || !screen) return nullptr;
-    int total_w = 0;
-    int max_h = 0;
-    for (auto &p : imgs) { if (p.second) { total_w += p.second->w; max_h = std::max(max_h, p.second->h); } }
-    if (total_w <= 0 || max_h <= 0) return nullptr;
-
-    SDL_Surface *atlas = SDL_CreateRGBSurface(SDL_SWSURFACE, total_w, max_h,
-                                              screen->format->BitsPerPixel,
-                                              screen->format->Rmask, screen->format->Gmask,
-                                              screen->format->Bmask, screen->format->Amask);
-    if (!atlas) return nullptr;
-
-    int x = 0;
-    for (auto &p : imgs) {
-        SDL_Surface *s = p.second;
-        SDL_Rect dst;
-        dst.x = static_cast<Sint16>(x);
-        dst.y = 0;
-        dst.w = s ? s->w : 0;
-        dst.h = s ? s->h : 0;
-        if (s) SDL_BlitSurface(s, nullptr, atlas, &dst);
-        out_map[p.first] = dst;
-        x += dst.w;
+// Sprite atlas in the screen format (no alpha: covers are flattened onto the slot frame
+// color when uploaded).
+static SDL_Surface *create_atlas(SDL_Surface *screen, int w, int h) {
+    if (!screen || w <= 0 || h <= 0) return nullptr;
+    const SDL_PixelFormat *f = screen->format;
+    return SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, f->BitsPerPixel, f->Rmask, f->Gmask, f->Bmask, 0);
+}
+
+static bool same_format(const SDL_PixelFormat *a, const SDL_PixelFormat *b) {
+    return a->BitsPerPixel == b->BitsPerPixel && a->Rmask == b->Rmask && a->Gmask == b->Gmask &&
+           a->Bmask == b->Bmask && a->Amask == b->Amask;
+}
+
+// Scale `src` into `to` on `dst`, clipped to dst's clip rect (core::scale_blit_32/16).
+// Opaque covers already in the screen format are scaled straight into it; anything else
+// is scaled into `scratch` (src format, reused while big enough) and handed to
+// SDL_BlitSurface for conversion and alpha, exactly like the 1:1 path.
+static void blit_scaled(SDL_Surface *src, SDL_Surface *dst, const SDL_Rect &to, core::BlitFilter filter,
+                        SDL_Surface *&scratch) {
+    if (!src || !dst || to.w == 0 || to.h == 0) return;
+    const int bpp = src->format->BytesPerPixel;
+    if (bpp != 2 && bpp != 4) return;
+    if (src->w == to.w && src->h == to.h) {
+        SDL_Rect d = to;
+        SDL_BlitSurface(src, nullptr, dst, &d);
+        return;
+    }
+    // 16-bit bilinear interpolates RGB565; other 16-bit layouts fall back to nearest
+    if (bpp == 2 && !(src->format->Rmask == 0xF800 && src->format->Gmask == 0x07E0 && src->format->Bmask == 0x001F))
+        filter = core::BlitFilter::NEAREST;
+
+    auto scale_into = [&](SDL_Surface *out, const core::BlitRect &rect, const core::BlitRect &clip) {
+        if (SDL_MUSTLOCK(src)) SDL_LockSurface(src);
+        if (SDL_MUSTLOCK(out)) SDL_LockSurface(out);
+        const Uint8 *sp = static_cast<const Uint8*>(src->pixels);
+        Uint8 *dp = static_cast<Uint8*>(out->pixels);
+        if (bpp == 4) core::scale_blit_32(sp, src->w, src->h, src->pitch, dp, out->pitch, rect, clip, filter);
+        else core::scale_blit_16(sp, src->w, src->h, src->pitch, dp, out->pitch, rect, clip, filter);
+        if (SDL_MUSTLOCK(out)) SDL_UnlockSurface(out);
+        if (SDL_MUSTLOCK(src)) SDL_UnlockSurface(src);
+    };
+
+    const core::BlitRect rect{to.x, to.y, to.w, to.h};
+    if (same_format(src->format, dst->format) && !(src->flags & SDL_SRCALPHA)) {
+        const SDL_Rect &c = dst->clip_rect;
+        scale_into(dst, rect, core::BlitRect{c.x, c.y, c.w, c.h});
+        return;
     }
-    return atlas;
+
+    if (scratch && (!same_format(scratch->format, src->format) || scratch->w < to.w || scratch->h < to.h)) {
+        SDL_FreeSurface(scratch);
+        scratch = nullptr;
+    }
+    if (!scratch) {
+        const SDL_PixelFormat *f = src->format;
+        scratch = SDL_CreateRGBSurface(SDL_SWSURFACE, to.w, to.h, f->BitsPerPixel, f->Rmask, f->Gmask, f->Bmask, f->Amask);
+        if (!scratch) return;
+    }
+    const core::BlitRect local{0, 0, to.w, to.h};
+    scale_into(scratch, local, local);
+    SDL_Rect s = {0, 0, to.w, to.h};
+    SDL_Rect d = to;
+    SDL_BlitSurface(scratch, &s, dst, &d);
 }
 
-void Renderer::draw_game_carousel(const std::vector<Game> &games, size_t active_index, ImageCache *cache) {
+void Renderer::draw_game_carousel(const std::vector<Game> &games, size_t active_index, ImageCache *cache, float scroll) {
     if (!pimpl->screen) return;
     
-    // Default values (fallback if config not set)
-    int center_x = pimpl->width / 2;
-    int center_y = pimpl->height / 2 - 20;
-    int active_w = 360;
-    int active_h = 200;
-    int side_w = 220;
-    int side_h = 140;
-    int spacing = 24;
-    double side_scale = 0.78;
-    
-    // Load from config if available - use this->config_ member variable
-    if (this->config_) {
-        auto *cfg = this->config_;
-        
-        // Read game_image config section
-        center_x = cfg->get<int>("ui.game_image.x", pimpl->width / 2);
-        center_y = cfg->get<int>("ui.game_image.y", pimpl->height / 2 - 20);
-        active_w = cfg->get<int>("ui.game_image.width", 360);
-        active_h = cfg->get<int>("ui.game_image.height", 200);
-        spacing = cfg->get<int>("ui.game_image.margin", 24);
-        side_scale = cfg->get<double>("ui.game_image.side_scale", 0.78);
-        
-        // Calculate side dimensions from active dimensions and side_scale
-        side_w = static_cast<int>(active_w * side_scale);
-        side_h = static_cast<int>(active_h * side_scale);
-    }
+    // Geometry and decoration shared with the other backends (ui/carousel_layout)
+    const ui::CarouselStyle st = ui::carousel_style(this->config_, pimpl->width, pimpl->height);
+    const int active_w = st.active_w, active_h = st.active_h, side_w = st.side_w, side_h = st.side_h;
 
     if (pimpl->sprite_layer_mode) {
-        std::vector<std::pair<std::string, SDL_Surface*>> entries;
-        for (size_t i = 0; i < games.size(); ++i) {
-            SDL_Surface *surf = nullptr;
-            if (cache) surf = static_cast<SDL_Surface*>(cache->get_surface_for_path(games[i].path));
-            std::string art_path = find_art_for_game(games[i]);
-            if (!art_path.empty())
-                entries.emplace_back(art_path, static_cast<SDL_Surface*>(cache->get_surface_for_path(art_path)));
-            else
-                entries.emplace_back(games[i].path, static_cast<SDL_Surface*>(cache->get_surface_for_path(games[i].path)));
+        // Sized for the visible window plus the prefetch ring: every slot and the two that
+        // scroll in on the next move at side size, and three at active size (the center and
+        // its neighbours, which take the center during a move), with one spare row.
+        const int n_side = static_cast<int>(games.size()) + 2;
+        const int n_active = 3;
+        const int atlas_w = std::min(2048, std::max(active_w, side_w) * 4);
+        const int cols_a = std::max(1, atlas_w / std::max(1, active_w));
+        const int cols_s = std::max(1, atlas_w / std::max(1, side_w));
+        const int atlas_h = ((n_active + cols_a - 1) / cols_a + 1) * active_h + ((n_side + cols_s - 1) / cols_s) * side_h;
+        if (!pimpl->sprite_atlas || pimpl->atlas_packer.width() != atlas_w || pimpl->atlas_packer.height() != atlas_h) {
+            if (pimpl->sprite_atlas) SDL_FreeSurface(pimpl->sprite_atlas);
+            pimpl->sprite_atlas = create_atlas(pimpl->screen, atlas_w, atlas_h);
+            pimpl->atlas_packer.reset(atlas_w, atlas_h);
         }
-        if (pimpl->sprite_atlas) { SDL_FreeSurface(pimpl->sprite_atlas); pimpl->sprite_atlas = nullptr; pimpl->atlas_map.clear(); }
-        pimpl->sprite_atlas = build_atlas(pimpl->screen, entries, pimpl->atlas_map);
+        pimpl->atlas_packer.begin_frame();
     }
 
-    for (size_t i = 0; i < games.size(); ++i) {
-        int rel = int(i) - int(active_index);
-        int w = (rel == 0) ? active_w : side_w;
-        int h = (rel == 0) ? active_h : side_h;
-        int x = center_x + rel * (w + spacing) - w / 2;
-        int y = center_y - h / 2;
-
-        // draw border
-        draw_filled_rect(pimpl->screen, x - 6, y - 6, w + 12, h + 12, 30, 30, 30);
-
-        SDL_Surface *art = nullptr;
-        std::string art_path = find_art_for_game(games[i]);
-        if (!art_path.empty()) {
-            art = static_cast<SDL_Surface*>(cache->get_surface_for_path(art_path));
-        } else {
-            if (cache) art = static_cast<SDL_Surface*>(cache->get_surface_for_path(games[i].path));
+    // Glow mask at the active size, blended with core::blend_color_* every frame
+    if (st.glow) pimpl->glow.update(st);
+
+    SDL_Surface *screen = pimpl->screen;
+    for (const ui::CarouselSlot &slot : ui::carousel_slots(games.size(), active_index, scroll, st)) {
+        const size_t i = slot.index;
+        const bool focused = slot.focused;
+        const int x = slot.x, y = slot.y, w = slot.w, h = slot.h;
+
+        if (st.glow && focused) {
+            const ui::GlowDraw g = pimpl->glow.draw(slot, st);
+            const Uint8 gr = st.glow_rgb[0], gg = st.glow_rgb[1], gb = st.glow_rgb[2];
+            const Uint8 *mask = pimpl->glow.mask();
+            const int pitch = pimpl->glow.mask_pitch();
+            pimpl->draw_list.add(g.rect, g.hash, [=] {
+                blend_rect(screen, g.rect.x, g.rect.y, g.rect.w, g.rect.h, gr, gg, gb, g.alpha, mask, pitch);
+            });
         }
 
-        // sprite atlas rendering
-        if (pimpl->sprite_layer_mode && pimpl->sprite_atlas) {
-            auto it = pimpl->atlas_map.find(games[i].path);
-            if (it != pimpl->atlas_map.end()) {
-                SDL_Rect src = it->second;
-                SDL_Rect dst;
-                dst.x = static_cast<Sint16>(x);
-                dst.y = static_cast<Sint16>(y);
-                dst.w = static_cast<Uint16>(w);
-                dst.h = static_cast<Uint16>(h);
-
-                if (static_cast<int>(src.w) == dst.w && static_cast<int>(src.h) == dst.h) {
-                    SDL_BlitSurface(pimpl->sprite_atlas, &src, pimpl->screen, &dst);
-                } else {
-                    SDL_Surface *temp = SDL_CreateRGBSurface(SDL_SWSURFACE, dst.w, dst.h,
-                                                             pimpl->screen->format->BitsPerPixel,
-                                                             pimpl->screen->format->Rmask,
-                                                             pimpl->screen->format->Gmask,
-                                                             pimpl->screen->format->Bmask,
-                                                             pimpl->screen->format->Amask);
-                    if (temp) {
-                        SDL_Rect crop = src;
-                        int crop_w = static_cast<int>(crop.w);
-                        int crop_h = static_cast<int>(crop.h);
-                        if (crop_w > dst.w) { crop.x += (crop_w - dst.w) / 2; crop_w = std::min<int>(crop_w, static_cast<int>(dst.w)); crop.w = static_cast<Uint16>(crop_w); }
-                        if (crop_h > dst.h) { crop.y += (crop_h - dst.h) / 2; crop_h = std::min<int>(crop_h, static_cast<int>(dst.h)); crop.h = static_cast<Uint16>(crop_h); }
-                        SDL_Rect dest0; dest0.x = 0; dest0.y = 0; dest0.w = crop.w; dest0.h = crop.h;
-                        SDL_BlitSurface(pimpl->sprite_atlas, &crop, temp, &dest0);
-                        SDL_Rect dest_final = dst;
-                        SDL_BlitSurface(temp, nullptr, pimpl->screen, &dest_final);
-                        SDL_FreeSurface(temp);
-                    } else {
-                        SDL_Rect crop = src;
-                        int crop_w = static_cast<int>(crop.w);
-                        int crop_h = static_cast<int>(crop.h);
-                        if (crop_w > w) { crop.x += (crop_w - w) / 2; crop_w = std::min(crop_w, w); crop.w = static_cast<Uint16>(crop_w); }
-                        if (crop_h > h) { crop.y += (crop_h - h) / 2; crop_h = std::min(crop_h, h); crop.h = static_cast<Uint16>(crop_h); }
-                        SDL_Rect dest;
-                        dest.x = static_cast<Sint16>(x);
-                        dest.y = static_cast<Sint16>(y);
-                        dest.w = static_cast<Uint16>(crop.w);
-                        dest.h = static_cast<Uint16>(crop.h);
-                        SDL_BlitSurface(pimpl->sprite_atlas, &crop, pimpl->screen, &dest);
-                    }
+        // Covers are pre-fitted to the active and side sizes by ImageCache
+        // (ui.game_image.scale) and blitted 1:1 there. In-between sizes of an animation
+        // scale the nearest larger level of the active cover's mip chain.
+        SDL_Surface *art = nullptr;
+        const std::string art_path = ui::carousel_art_path(games[i]);
+
+        // sprite atlas rendering: a cover is copied into its atlas region the first time it
+        // is drawn at this size; later frames only blit the packed region
+        bool from_atlas = false;
+        core::AtlasRect region;
+        if (pimpl->sprite_layer_mode && pimpl->sprite_atlas && slot.prefitted) {
+            const std::string id = art_path + "@" + std::to_string(w) + "x" + std::to_string(h);
+            from_atlas = pimpl->atlas_packer.find(id, region);
+            if (!from_atlas && cache) {
+                art = static_cast<SDL_Surface*>(cache->get_scaled_surface(art_path, w, h));
+                if (art && pimpl->atlas_packer.insert(id, w, h, region)) {
+                    SDL_Rect up = {static_cast<Sint16>(region.x), static_cast<Sint16>(region.y),
+                                   static_cast<Uint16>(w), static_cast<Uint16>(h)};
+                    SDL_FillRect(pimpl->sprite_atlas, &up, SDL_MapRGB(pimpl->sprite_atlas->format, 30, 30, 30));
+                    SDL_BlitSurface(art, nullptr, pimpl->sprite_atlas, &up);
+                    from_atlas = true;
                 }
-            } else {
-                if (rel == 0) draw_filled_rect(pimpl->screen, x, y, w, h, 100, 100, 140);
-                else draw_filled_rect(pimpl->screen, x, y, w, h, 70, 70, 90);
             }
-        } else {
-            if (art) {
-                if (art->w == w && art->h == h) {
-                    SDL_Rect dst;
-                    dst.x = static_cast<Sint16>(x);
-                    dst.y = static_cast<Sint16>(y);
-                    dst.w = static_cast<Uint16>(w);
-                    dst.h = static_cast<Uint16>(h);
-                    SDL_BlitSurface(art, nullptr, pimpl->screen, &dst);
-                } else {
-                    int cx = std::max(0, (art->w - w) / 2);
-                    int cy = std::max(0, (art->h - h) / 2);
-                    int use_w = std::min(art->w, w);
-                    int use_h = std::min(art->h, h);
-                    SDL_Rect crop;
-                    crop.x = static_cast<Sint16>(cx);
-                    crop.y = static_cast<Sint16>(cy);
-                    crop.w = static_cast<Uint16>(use_w);
-                    crop.h = static_cast<Uint16>(use_h);
-                    SDL_Rect dest;
-                    dest.x = static_cast<Sint16>(x);
-                    dest.y = static_cast<Sint16>(y);
-                    dest.w = static_cast<Uint16>(crop.w);
-                    dest.h = static_cast<Uint16>(crop.h);
-                    SDL_BlitSurface(art, &crop, pimpl->screen, &dest);
-                }
+        } else if (cache) {
+            art = static_cast<SDL_Surface*>(slot.prefitted ? cache->get_scaled_surface(art_path, w, h)
+                                                      : cache->get_mip_for_size(art_path, active_w, active_h, w, h));
+        }
+
+        // Frame, cover (or placeholder) and contour as one command over the frame rect
+        const ui::SlotDraw d = ui::carousel_slot_draw(slot, st, art_path, from_atlas || art != nullptr);
+        const core::BlitFilter filter = st.filter;
+        const core::ShapeStyle contour_style = st.contour;
+        auto *atlas = &pimpl->sprite_atlas;
+        auto *shapes = &pimpl->shape_cache;
+        auto *scratch = &pimpl->scale_scratch;
+        pimpl->draw_list.add(d.bounds, d.hash, [=] {
+            const core::BlitRect &b = d.bounds;
+            draw_filled_rect(screen, b.x, b.y, b.w, b.h, ui::kCarouselFrameRgb[0], ui::kCarouselFrameRgb[1],
+                             ui::kCarouselFrameRgb[2]);
+            SDL_Rect dst;
+            dst.x = static_cast<Sint16>(x);
+            dst.y = static_cast<Sint16>(y);
+            dst.w = static_cast<Uint16>(w);
+            dst.h = static_cast<Uint16>(h);
+            if (from_atlas && *atlas) {
+                SDL_Rect src = {static_cast<Sint16>(region.x), static_cast<Sint16>(region.y),
+                                static_cast<Uint16>(region.w), static_cast<Uint16>(region.h)};
+                SDL_BlitSurface(*atlas, &src, screen, &dst);
+            } else if (art && !from_atlas) {
+                blit_scaled(art, screen, dst, filter, *scratch);
             } else {
-                if (rel == 0) draw_filled_rect(pimpl->screen, x, y, w, h, 100, 100, 140);
-                else draw_filled_rect(pimpl->screen, x, y, w, h, 70, 70, 90);
+                draw_filled_rect(screen, x, y, w, h, d.placeholder[0], d.placeholder[1], d.placeholder[2]);
             }
-        }
+            // contour over the frame of the settled focused slot (one cached sprite blit)
+            if (d.contour) draw_shape(*shapes, screen, b.x, b.y, b.w, b.h, contour_style);
+        });
 
-        // draw title
-        std::string label = games[i].name.empty() ? basename_from_path(games[i].path) : games[i].name;
-        if (rel == 0) draw_text(center_x - 200, center_y + active_h / 2 + 8, label, true);
-        else draw_text(x + 8, y + 8, label, false);
+        draw_text(d.label_x, d.label_y, ui::game_label(games[i]), focused);
     }
 }
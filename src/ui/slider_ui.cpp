@@ -2,10 +2,12 @@
 #include "core/global.h"
 #include "ui/renderer.h"
 #include "ui/menu_config.h"
+#include "ui/carousel_anim.h"
 #include "core/config_manager.h"
 #include "core/game_db.h"
 #include "core/sort.h"
 #include "core/image_cache.h"
+#include "core/image_loader.h"
 #include "core/logger.h"
 
 #include <iostream>
@@ -53,12 +55,12 @@ int slider_main(const std::string &config_path,
                 const std::string &csv_path,
                 [[maybe_unused]] const std::string &mode,
                 [[maybe_unused]] const std::string &exit_mode_flag) {
-  Logger::instance().info("slider_main start");
-
   ConfigManager cfg;
   if (!cfg.load(config_path)) {
     std::cerr << "[slider] warning: could not load config, using defaults\n";
   }
+  Logger::instance().init_from_config(cfg, global::g_exe_dir);
+  LOG_INFO(SLIDER, "slider_main start");
 
   // Load GameDB
   GameDB game_db;
@@ -104,16 +106,29 @@ int slider_main(const std::string &config_path,
   // Honor optional RGBA preference from config (default: false => RGB-only)
   bool prefer_rgba = cfg.get<bool>("ui.images.rgba", false);
   cache.set_prefer_rgba(prefer_rgba);
+  // Cover surfaces in the screen's pixel format (platform.color_depth), so blits are copies
+  cache.set_surface_depth(cfg.get<int>("platform.color_depth", 32), cfg.get<bool>("platform.dither", true));
+  // Enforce platform.image_max_dimensions and platform.image_formats on every decode;
+  // covers are never shown larger than the active carousel slot
+  core::configure_image_decoding(cfg);
+  const int cover_w = cfg.get<int>("ui.game_image.width", 200);
+  const int cover_h = cfg.get<int>("ui.game_image.height", 270);
+  const double side_scale = cfg.get<double>("ui.game_image.side_scale", 0.78);
+  cache.set_decode_size_hint(cover_w, cover_h);
+  // Fit/fill covers to the active and side slot sizes once, at decode time; the letterbox
+  // matches the carousel frame color (30,30,30) drawn behind each slot
+  cache.set_display_sizes({{cover_w, cover_h},
+                           {static_cast<int>(cover_w * side_scale), static_cast<int>(cover_h * side_scale)}},
+                          core::scale_mode_from_string(cfg.get<std::string>("ui.game_image.scale", "fit")),
+                          0x1E1E1E);
 
   // Initialize menu config (loads sliderUI_cfg.json)
   menu::MenuConfig::init(global::g_exe_dir + "cfg/sliderUI_cfg.json");
 
-  // Renderer
+  // Renderer (config first: init() picks the video mode from platform.color_depth)
   Renderer renderer;
-  renderer.init();
-  
-  // Pass config to renderer for aesthetics
   renderer.set_config(&cfg);
+  renderer.init();
 
   bool running = true;
   bool pending_delete = false;
@@ -128,6 +143,17 @@ int slider_main(const std::string &config_path,
   const auto key_repeat_rate = std::chrono::milliseconds(150);           // Then repeat every 150ms
   bool is_repeating = false;
 
+  // Carousel animation (ui.animation.*); the loop runs at a fixed frame period instead of
+  // sleeping a flat 40ms after the work
+  ui::CarouselAnimator anim;
+  anim.configure(cfg);
+  ui::FramePacer pacer(cfg.get<int>("ui.animation.fps", 60));
+
+  // ui.background: empty => none, relative names live in assets/. Resolved once; the
+  // renderer keeps the decoded image and only reloads it when the file changes.
+  std::string background = cfg.get<std::string>("ui.background", std::string());
+  if (!background.empty() && background[0] != '/') background = global::g_exe_dir + "assets/" + background;
+
   // Helper to persist current sort_mode string to cfg
   auto save_sort_mode = [&](SortMode m) {
     std::string s = sort_mode_to_string(m);
@@ -161,10 +187,8 @@ int slider_main(const std::string &config_path,
       size_t idx_prev = (active == 0) ? (n - 1) : (active - 1);
       size_t idx_next = (active + 1) % n;
 
-      // Use synchronous preload available in ImageCache implementation
-      cache.preload(view[idx_prev].path);
-      cache.preload(view[active].path);
-      cache.preload(view[idx_next].path);
+      // Decode the three neighbours in parallel (already cached ones return immediately)
+      cache.preload_many({view[idx_prev].path, view[active].path, view[idx_next].path});
     }
 
     // NOTE: your ImageCache implementation is synchronous. There is no tick_one_task() here.
@@ -209,12 +233,14 @@ int slider_main(const std::string &config_path,
       if (in == ui::Input::LEFT) {
         if (!view.empty()) {
           active = (active + view.size() - 1) % view.size();
+          anim.shift(-1);
           pending_delete = false; // any navigation cancels pending deletion
           needs_redraw = true;    // Mark for redraw
         }
       } else if (in == ui::Input::RIGHT) {
         if (!view.empty()) {
           active = (active + 1) % view.size();
+          anim.shift(+1);
           pending_delete = false;
           needs_redraw = true;    // Mark for redraw
         }
@@ -226,7 +252,7 @@ int slider_main(const std::string &config_path,
           cfg.save(config_path);
           // Launch - in stub we only log; in a non-stub build you might call system(...)
           std::cout << "[slider] launching game: " << g.path << " (stub: logging only)\n";
-          Logger::instance().info(std::string("launch: ") + g.path);
+          LOG_INFO(SLIDER, "launch: " + g.path);
           // No redraw needed for launch, but you could add it if you want feedback
         }
       } else if (in == ui::Input::X) {
@@ -238,6 +264,7 @@ int slider_main(const std::string &config_path,
         // On sort change reset active to 0 as specified
         active = 0;
         rebuild_view();
+        anim.reset();
         pending_delete = false;
         needs_redraw = true;    // Mark for redraw
       } else if (in == ui::Input::Y) {
@@ -263,11 +290,12 @@ int slider_main(const std::string &config_path,
                   if (!game_db.commit()) {
                     std::cerr << "[slider] failed to commit GameDB after removal\n";
                   } else {
-                    Logger::instance().info(std::string("removed: ") + path_to_remove);
+                    LOG_INFO(SLIDER, "removed: " + path_to_remove);
                   }
                 }
                 // rebuild view and clamp active
                 rebuild_view();
+                anim.reset();
                 needs_redraw = true;  // Mark for redraw
               }
             }
@@ -300,28 +328,23 @@ int slider_main(const std::string &config_path,
     // Reload config if hot-reloading is enabled
     menu::MenuConfig::reload_if_enabled(); // This function returns void
 
-    // ONLY render if something changed
-    if (needs_redraw) {
-      renderer.clear();
-      
-      // Background (if configured)
-      std::string bkg = cfg.get<std::string>("ui.background", std::string(global::g_exe_dir + "assets/bckg.png"));
-      renderer.draw_background(bkg);
+    // ONLY render if something changed or the carousel is still moving
+    if (needs_redraw || anim.animating()) {
+      // Background image, or the plain clear() fill when none is configured
+      renderer.draw_background(background);
 
-      // Draw carousel: build a small slice to show. We'll pass the three items centered on active.
+      // Draw carousel: build a small slice centered on active. Two items per side so the
+      // slot scrolling in from the edge is already there while animating.
       std::vector<Game> slice;
+      size_t radius = view.size() >= 5 ? 2 : 1;
       if (!view.empty()) {
         size_t n = view.size();
-        size_t prev = (active + n - 1) % n;
-        size_t next = (active + 1) % n;
-        slice.push_back(view[prev]);
-        slice.push_back(view[active]);
-        slice.push_back(view[next]);
+        for (size_t k = 0; k < 2 * radius + 1; ++k) slice.push_back(view[(active + n - radius + k) % n]);
       }
-      renderer.draw_game_carousel(slice, slice.empty() ? 0 : 1, &cache);
+      renderer.draw_game_carousel(slice, slice.empty() ? 0 : radius, &cache, anim.scroll());
 
-      // Draw help - using config for positioning
-      renderer.draw_text(6, menu::MenuConfig::SCREEN_HEIGHT() - 40, "A: play   X: sort   Y: remove   B: exit");
+      // Control hints - placed and styled by ui.buttons
+      renderer.draw_button_bar("A: play   X: sort   Y: remove   B: exit");
 
       // If pending_delete show overlay
       if (pending_delete) {
@@ -332,12 +355,12 @@ int slider_main(const std::string &config_path,
       needs_redraw = false;  // Clear the flag after rendering
     }
 
-    std::this_thread::sleep_for(40ms);  // Still sleep to avoid busy-waiting on input
+    anim.advance(pacer.wait());  // Sleep out the rest of the frame, then step the animation
   }
 
   // On exit ensure pending deletion canceled
   pending_delete = false;
-  Logger::instance().info("slider_main exit");
+  LOG_INFO(SLIDER, "slider_main exit");
   renderer.shutdown();
   return 0;
 }
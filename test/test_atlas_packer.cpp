@@ -0,0 +1,72 @@
+#include "core/atlas_packer.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using core::AtlasPacker;
+using core::AtlasRect;
+
+static bool overlap(const AtlasRect &a, const AtlasRect &b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+int main() {
+    // mixed sizes pack without overlap and inside the atlas
+    AtlasPacker packer(256, 256);
+    packer.begin_frame();
+    std::vector<AtlasRect> rects;
+    const int sizes[][2] = {{100, 60}, {78, 47}, {78, 47}, {100, 60}, {78, 47}, {50, 120}, {78, 47}, {30, 30}};
+    for (int i = 0; i < 8; ++i) {
+        AtlasRect r;
+        if (!packer.insert("img" + std::to_string(i), sizes[i][0], sizes[i][1], r)) {
+            std::cerr << "[FAIL] insert " << i << "\n"; return 1;
+        }
+        if (r.x < 0 || r.y < 0 || r.x + r.w > 256 || r.y + r.h > 256 || r.w != sizes[i][0] || r.h != sizes[i][1]) {
+            std::cerr << "[FAIL] rect out of bounds " << i << "\n"; return 2;
+        }
+        for (const AtlasRect &o : rects) {
+            if (overlap(o, r)) { std::cerr << "[FAIL] overlap at " << i << "\n"; return 3; }
+        }
+        rects.push_back(r);
+    }
+
+    // ids are stable: the same id finds the same region, a second insert is a no-op
+    AtlasRect again;
+    if (!packer.find("img3", again) || again.x != rects[3].x || again.y != rects[3].y) {
+        std::cerr << "[FAIL] find by id\n"; return 4;
+    }
+    if (!packer.insert("img3", 100, 60, again) || again.x != rects[3].x || packer.size() != 8) {
+        std::cerr << "[FAIL] re-insert\n"; return 5;
+    }
+
+    // a full atlas evicts the least recently used entry and reuses its region
+    AtlasPacker small(200, 100);
+    AtlasRect a, b, c;
+    small.begin_frame();
+    small.insert("a", 100, 100, a);
+    small.insert("b", 100, 100, b);
+    small.begin_frame();
+    small.find("b", b); // b used this frame, a is older
+    if (!small.insert("c", 90, 90, c) || small.find("a", a) || c.x != 0 || c.y != 0) {
+        std::cerr << "[FAIL] LRU eviction\n"; return 6;
+    }
+
+    // entries used in the current frame are never evicted
+    AtlasRect d;
+    if (small.insert("d", 100, 100, d)) { std::cerr << "[FAIL] evicted a pinned entry\n"; return 7; }
+    if (!small.find("b", b) || !small.find("c", c)) { std::cerr << "[FAIL] pinned entry lost\n"; return 8; }
+
+    // evicting everything resets the skyline so a differently sized set fits again
+    small.evict("b");
+    small.evict("c");
+    AtlasRect wide;
+    if (!small.insert("wide", 200, 100, wide) || wide.x != 0 || wide.y != 0) {
+        std::cerr << "[FAIL] reset after full eviction\n"; return 9;
+    }
+
+    // oversized items are refused
+    if (small.insert("huge", 300, 10, wide)) { std::cerr << "[FAIL] oversized insert\n"; return 10; }
+
+    std::cout << "[OK] atlas_packer test passed\n";
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include "core/canvas.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using core::BlitRect;
+using core::Canvas;
+
+static uint32_t px32(const Canvas &c, int x, int y) {
+    // the X byte is unused (blends may leave it set)
+    return reinterpret_cast<const uint32_t*>(c.data() + static_cast<size_t>(y) * c.pitch())[x] & 0xFFFFFF;
+}
+
+static uint16_t px16(const Canvas &c, int x, int y) {
+    return reinterpret_cast<const uint16_t*>(c.data() + static_cast<size_t>(y) * c.pitch())[x];
+}
+
+int main() {
+    // fill_rect is clipped to the canvas and to set_clip()
+    Canvas c(8, 4, 32);
+    c.fill_rect(-2, -2, 4, 4, 255, 0, 0);
+    if (px32(c, 1, 1) != 0xFF0000 || px32(c, 2, 0) != 0 || px32(c, 0, 2) != 0) {
+        std::cerr << "[FAIL] fill_rect clipping\n"; return 1;
+    }
+    c.set_clip(BlitRect{4, 0, 2, 4});
+    c.fill_rect(0, 0, 8, 4, 0, 255, 0);
+    if (px32(c, 3, 0) == 0x00FF00 || px32(c, 4, 0) != 0x00FF00 || px32(c, 6, 3) == 0x00FF00) {
+        std::cerr << "[FAIL] set_clip\n"; return 2;
+    }
+
+    // 565 layout and get_rgb's bit replication
+    Canvas s(2, 2, 16);
+    s.fill_rect(0, 0, 2, 2, 255, 128, 8);
+    uint8_t r, g, b;
+    s.get_rgb(1, 1, r, g, b);
+    if (px16(s, 0, 0) != 0xFC01 || r != 255 || g != 130 || b != 8) {
+        std::cerr << "[FAIL] 565 fill/get_rgb " << std::hex << px16(s, 0, 0) << "\n"; return 3;
+    }
+
+    // blend_rect matches blend_color_32: half-alpha white over black
+    Canvas d(4, 1, 32);
+    d.blend_rect(0, 0, 4, 1, 255, 255, 255, 128);
+    d.get_rgb(3, 0, r, g, b);
+    if (r != 128 || g != 128 || b != 128) { std::cerr << "[FAIL] blend_rect " << int(r) << "\n"; return 4; }
+
+    // blit copies and clips; mismatched formats are refused
+    Canvas src(2, 2, 32);
+    src.fill_rect(0, 0, 2, 2, 1, 2, 3);
+    Canvas dst(3, 3, 32);
+    if (!dst.blit(src, 2, 2) || px32(dst, 2, 2) != 0x010203 || px32(dst, 1, 1) != 0) {
+        std::cerr << "[FAIL] blit\n"; return 5;
+    }
+    if (dst.blit(s, 0, 0)) { std::cerr << "[FAIL] blit across formats\n"; return 6; }
+
+    // blit_scaled fills exactly the target rect
+    Canvas big(6, 6, 32);
+    big.blit_scaled(src, BlitRect{1, 1, 4, 4}, core::BlitFilter::NEAREST);
+    if (px32(big, 1, 1) != 0x010203 || px32(big, 4, 4) != 0x010203 || px32(big, 5, 5) != 0 || px32(big, 0, 0) != 0) {
+        std::cerr << "[FAIL] blit_scaled\n"; return 7;
+    }
+
+    // blend_argb: opaque pixels replace, transparent ones leave the canvas alone
+    const uint32_t sprite[2] = {0xFF102030u, 0x00FFFFFFu};
+    Canvas sp(2, 1, 32);
+    sp.blend_argb(sprite, 8, 2, 1, 0, 0);
+    if (px32(sp, 0, 0) != 0x102030 || px32(sp, 1, 0) != 0) { std::cerr << "[FAIL] blend_argb\n"; return 8; }
+
+    // load_image: RGBA is flattened onto the matte, 565 without dither is plain truncation
+    const uint8_t rgba[8] = {200, 100, 50, 255, 255, 255, 255, 0};
+    Canvas li(0, 0, 32);
+    if (!li.load_image(rgba, 2, 1, 4, true, 0x0000FF) || px32(li, 0, 0) != 0xC86432 || px32(li, 1, 0) != 0x0000FF) {
+        std::cerr << "[FAIL] load_image 32\n"; return 9;
+    }
+    Canvas li16(0, 0, 16);
+    if (!li16.load_image(rgba, 2, 1, 4, false, 0) || px16(li16, 0, 0) != ((25 << 11) | (25 << 5) | 6) ||
+        px16(li16, 1, 0) != 0) {
+        std::cerr << "[FAIL] load_image 565\n"; return 10;
+    }
+
+    // downsample_2x halves the size and averages 2x2 blocks
+    Canvas ds(4, 2, 32);
+    ds.fill_rect(0, 0, 1, 2, 200, 200, 200);
+    Canvas half = ds.downsample_2x();
+    half.get_rgb(0, 0, r, g, b);
+    if (half.width() != 2 || half.height() != 1 || r != 100) {
+        std::cerr << "[FAIL] downsample_2x " << int(r) << "\n"; return 11;
+    }
+
+    // write_ppm: P6 header, then RGB rows
+    const std::string ppm = "test_canvas_out.ppm";
+    if (!li.write_ppm(ppm)) { std::cerr << "[FAIL] write_ppm\n"; return 12; }
+    std::ifstream in(ppm, std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::remove(ppm.c_str());
+    const std::string expect = std::string("P6\n2 1\n255\n") + "\xC8\x64\x32" + std::string("\0\0\xFF", 3);
+    if (data != expect) { std::cerr << "[FAIL] ppm contents\n"; return 13; }
+
+    // shapes: the fill is opaque inside, the corners outside the radius are transparent
+    core::ShapeStyle st;
+    st.radius = 4;
+    st.stroke = 1;
+    st.fill[0] = 96;
+    const std::vector<uint32_t> shape = core::render_shape(12, 12, st);
+    if (shape.size() != 144 || (shape[6 * 12 + 6] >> 24) != 255 || (shape[0] >> 24) != 0 ||
+        ((shape[6 * 12 + 6] >> 16) & 0xFF) != 96) {
+        std::cerr << "[FAIL] render_shape\n"; return 14;
+    }
+    uint8_t a = 0;
+    if (!core::parse_hex_color("#10203040", r, g, b, a) || r != 0x10 || a != 0x40 || core::parse_hex_color("123", r, g, b, a)) {
+        std::cerr << "[FAIL] parse_hex_color\n"; return 15;
+    }
+
+    std::cout << "[OK] canvas\n";
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include "ui/carousel_anim.h"
+#include <cmath>
+#include <iostream>
+
+using ui::CarouselAnimator;
+using ui::Easing;
+using ui::FramePacer;
+
+static bool near(float a, float b, float eps = 1e-4f) { return std::fabs(a - b) <= eps; }
+
+int main() {
+    // every easing starts at 0 and ends at 1
+    for (Easing e : {Easing::LINEAR, Easing::EASE_OUT_CUBIC, Easing::EASE_IN_OUT_QUAD}) {
+        if (!near(ui::ease(e, 0.f), 0.f) || !near(ui::ease(e, 1.f), 1.f)) {
+            std::cerr << "[FAIL] easing endpoints\n"; return 1;
+        }
+    }
+    if (ui::easing_from_string("Linear") != Easing::LINEAR ||
+        ui::easing_from_string("ease_in_out_quad") != Easing::EASE_IN_OUT_QUAD ||
+        ui::easing_from_string("bogus", Easing::LINEAR) != Easing::LINEAR) {
+        std::cerr << "[FAIL] easing_from_string\n"; return 2;
+    }
+
+    // a shift jumps the scroll by the delta, then eases back to 0 within the duration
+    CarouselAnimator anim(100.f, 10.f, Easing::LINEAR);
+    anim.shift(+1);
+    if (!anim.animating() || !near(anim.scroll(), 1.f)) { std::cerr << "[FAIL] shift start\n"; return 3; }
+    anim.advance(50.f);
+    if (!near(anim.scroll(), 0.5f)) { std::cerr << "[FAIL] halfway scroll: " << anim.scroll() << "\n"; return 4; }
+    anim.advance(50.f);
+    if (anim.animating() || anim.scroll() != 0.f) { std::cerr << "[FAIL] did not settle\n"; return 5; }
+
+    // retargeting mid-flight keeps the position continuous
+    anim.shift(-1);
+    anim.advance(40.f);
+    float before = anim.scroll();
+    anim.shift(-1);
+    if (!near(anim.scroll(), before - 1.f)) { std::cerr << "[FAIL] retarget jump\n"; return 6; }
+
+    // rapid repeats never scroll further than the drawn slots
+    for (int i = 0; i < 10; ++i) anim.shift(+1);
+    if (anim.scroll() > 2.f + 1e-4f) { std::cerr << "[FAIL] scroll not clamped\n"; return 7; }
+
+    // the fixed timestep makes the result independent of how frames split the time
+    CarouselAnimator a(180.f, 1000.f / 120.f), b(180.f, 1000.f / 120.f);
+    a.shift(+1);
+    b.shift(+1);
+    for (int i = 0; i < 6; ++i) a.advance(16.f);
+    for (int i = 0; i < 12; ++i) b.advance(8.f);
+    if (!near(a.scroll(), b.scroll())) { std::cerr << "[FAIL] frame-rate dependent scroll\n"; return 8; }
+
+    // a long stall does not skip the animation to its end
+    CarouselAnimator c(180.f, 10.f);
+    c.shift(+1);
+    c.advance(1000.f);
+    if (!c.animating()) { std::cerr << "[FAIL] stall skipped the animation\n"; return 9; }
+
+    // duration 0 disables the animation
+    CarouselAnimator off(0.f);
+    off.shift(+1);
+    if (off.animating()) { std::cerr << "[FAIL] zero duration animates\n"; return 10; }
+
+    // the pacer holds the loop near its period
+    FramePacer pacer(100);
+    pacer.wait();
+    float total = 0.f;
+    for (int i = 0; i < 5; ++i) total += pacer.wait();
+    if (total < 45.f || total > 150.f) { std::cerr << "[FAIL] pacer period: " << total << "ms for 5 frames\n"; return 11; }
+
+    std::cout << "[OK] carousel_anim test passed\n";
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include "ui/draw_list.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using core::BlitRect;
+using ui::DrawHash;
+using ui::DrawList;
+
+static uint64_t h(const std::string &s) { return DrawHash().add(s).value(); }
+
+static bool covers(const std::vector<BlitRect> &regions, int x, int y) {
+    for (const BlitRect &r : regions) {
+        if (x >= r.x && x < r.x + r.w && y >= r.y && y < r.y + r.h) return true;
+    }
+    return false;
+}
+
+int main() {
+    DrawList list;
+    list.set_screen(100, 70, 10);
+    std::vector<std::string> ran;
+    auto frame = [&](int box_x) {
+        list.add(BlitRect{0, 0, 100, 70}, h("clear"), [&] { ran.push_back("clear"); });
+        list.add(BlitRect{box_x, 20, 15, 15}, DrawHash().add(std::string("box")).add(box_x).value(),
+                 [&] { ran.push_back("box"); });
+    };
+
+    // the first frame is new everywhere: one region, the whole (uneven) screen
+    frame(10);
+    std::vector<BlitRect> regions = list.end_frame();
+    if (regions.size() != 1 || regions[0].x != 0 || regions[0].y != 0 || regions[0].w != 100 || regions[0].h != 70) {
+        std::cerr << "[FAIL] first frame not full screen\n"; return 1;
+    }
+    list.replay(regions[0]);
+    if (ran.size() != 2 || ran[0] != "clear" || ran[1] != "box") { std::cerr << "[FAIL] replay order\n"; return 2; }
+
+    // an identical frame changes nothing
+    frame(10);
+    if (!list.end_frame().empty()) { std::cerr << "[FAIL] identical frame reported changes\n"; return 3; }
+
+    // moving the box dirties its old and new tiles only
+    frame(50);
+    regions = list.end_frame();
+    if (regions.empty() || !covers(regions, 12, 22) || !covers(regions, 60, 30) || covers(regions, 5, 60) ||
+        covers(regions, 95, 5)) {
+        std::cerr << "[FAIL] changed tiles\n"; return 4;
+    }
+    for (const BlitRect &r : regions) {
+        if (r.x % 10 || r.y % 10 || r.x + r.w > 100 || r.y + r.h > 70) { std::cerr << "[FAIL] region bounds\n"; return 5; }
+    }
+
+    // replay only runs the commands that intersect the region
+    ran.clear();
+    list.replay(BlitRect{0, 50, 100, 20});
+    if (ran.size() != 1 || ran[0] != "clear") { std::cerr << "[FAIL] replay filter\n"; return 6; }
+
+    // a present without new commands leaves the screen alone
+    if (!list.end_frame().empty()) { std::cerr << "[FAIL] empty frame reported changes\n"; return 7; }
+
+    // invalidate() forces a full redraw of an unchanged frame
+    list.invalidate();
+    frame(50);
+    regions = list.end_frame();
+    if (regions.size() != 1 || regions[0].w != 100 || regions[0].h != 70) { std::cerr << "[FAIL] invalidate\n"; return 8; }
+
+    // same commands in another order hash differently
+    list.add(BlitRect{50, 20, 15, 15}, DrawHash().add(std::string("box")).add(50).value(), [] {});
+    list.add(BlitRect{0, 0, 100, 70}, h("clear"), [] {});
+    if (list.end_frame().empty()) { std::cerr << "[FAIL] command order ignored\n"; return 9; }
+
+    std::cout << "[OK] draw_list\n";
+    return 0;
+}
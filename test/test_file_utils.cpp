@@ -5,6 +5,7 @@
 #include <string>
 #include <cstdlib>
 #include <unistd.h>
+#include <utility>
 
 int main() {
     std::cout << "Running file_utils test...\n";
@@ -72,6 +73,47 @@ int main() {
         return 7;
     }
 
+    // MappedFile: small file goes through pread, large one is mmapped
+    {
+        file_utils::MappedFile small;
+        if (!small.open(test_path) || small.is_mapped() || small.size() != content2.size() ||
+            std::string(reinterpret_cast<const char*>(small.data()), small.size()) != content2) {
+            std::cerr << "[FAIL] MappedFile small read\n";
+            cleanup();
+            return 8;
+        }
+    }
+    std::string big(file_utils::MappedFile::kMapThreshold * 3 + 17, '\0');
+    for (size_t i = 0; i < big.size(); ++i) big[i] = static_cast<char>('a' + i % 26);
+    if (!file_utils::atomic_write(test_path, big)) {
+        std::cerr << "[FAIL] atomic_write big\n";
+        cleanup();
+        return 9;
+    }
+    {
+        file_utils::MappedFile mf;
+        if (!mf.open(test_path) || !mf.is_mapped() || mf.size() != big.size() ||
+            std::string(reinterpret_cast<const char*>(mf.data()), mf.size()) != big) {
+            std::cerr << "[FAIL] MappedFile mmap read\n";
+            cleanup();
+            return 10;
+        }
+        mf.done_reading();
+        // pages are re-read from the page cache after MADV_DONTNEED
+        file_utils::MappedFile moved(std::move(mf));
+        if (mf.data() != nullptr || moved.size() != big.size() || moved.data()[big.size() - 1] != big.back()) {
+            std::cerr << "[FAIL] MappedFile move/done_reading\n";
+            cleanup();
+            return 11;
+        }
+    }
+    file_utils::MappedFile missing;
+    if (missing.open(test_path + ".missing") || !missing.empty()) {
+        std::cerr << "[FAIL] MappedFile opened a missing file\n";
+        cleanup();
+        return 12;
+    }
+
     cleanup();
     std::cout << "[OK] test_file_utils passed\n";
     return 0;
@@ -1,14 +1,98 @@
 #include "core/image_loader.h"
+#include "core/cover_formats.h"
+#include "core/image_cache.h"
 #include <iostream>
 #include <fstream>
 #include <unistd.h>
 #include <vector>
 #include <cstdint>
+#include <utility>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <algorithm>
+
+#include "stb_image.h" // declarations only; the implementation lives in image_loader.cpp
+
+#ifdef HAVE_LIBPNG
+#include <png.h>
+
+// write a w x h RGBA PNG with a diagonal gradient and varying alpha
+static bool write_gradient_png(const std::string &path, int w, int h) {
+    FILE *f = std::fopen(path.c_str(), "wb");
+    if (!f) return false;
+    png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    png_infop info = png_create_info_struct(png);
+    if (setjmp(png_jmpbuf(png))) {
+        png_destroy_write_struct(&png, &info);
+        std::fclose(f);
+        return false;
+    }
+    png_init_io(png, f);
+    png_set_IHDR(png, info, static_cast<png_uint_32>(w), static_cast<png_uint_32>(h), 8, PNG_COLOR_TYPE_RGBA,
+                 PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png, info);
+    std::vector<unsigned char> row(static_cast<size_t>(w) * 4);
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            row[x * 4 + 0] = static_cast<unsigned char>(x * 255 / (w - 1));
+            row[x * 4 + 1] = static_cast<unsigned char>(y * 255 / (h - 1));
+            row[x * 4 + 2] = static_cast<unsigned char>((x + y) & 0xFF);
+            row[x * 4 + 3] = static_cast<unsigned char>(x & 0xFF);
+        }
+        png_write_row(png, row.data());
+    }
+    png_write_end(png, nullptr);
+    png_destroy_write_struct(&png, &info);
+    std::fclose(f);
+    return true;
+}
+#endif
+
+#ifdef HAVE_LIBJPEG
+#include <jpeglib.h>
+
+// write a w x h JPEG filled with one color
+static bool write_solid_jpeg(const std::string &path, int w, int h, unsigned char r, unsigned char g, unsigned char b) {
+    FILE *f = std::fopen(path.c_str(), "wb");
+    if (!f) return false;
+    jpeg_compress_struct cinfo;
+    jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_stdio_dest(&cinfo, f);
+    cinfo.image_width = static_cast<JDIMENSION>(w);
+    cinfo.image_height = static_cast<JDIMENSION>(h);
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, 95, TRUE);
+    jpeg_start_compress(&cinfo, TRUE);
+    std::vector<unsigned char> row(static_cast<size_t>(w) * 3);
+    for (int x = 0; x < w; ++x) { row[x * 3] = r; row[x * 3 + 1] = g; row[x * 3 + 2] = b; }
+    while (cinfo.next_scanline < cinfo.image_height) {
+        JSAMPROW rp = row.data();
+        jpeg_write_scanlines(&cinfo, &rp, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    std::fclose(f);
+    return true;
+}
+#endif
 
 using core::Texture;
 using core::decode_to_texture;
+using core::ResampleFilter;
+using core::resample_rgb_to_rgb565;
 
 // utility: convert rgb uint8 -> rgb565
+static bool write_bytes(const std::string &path, const std::vector<unsigned char> &bytes) {
+    std::ofstream f(path, std::ios::binary);
+    f.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(f);
+}
+
 static uint16_t rgb565_from_rgb(unsigned char r, unsigned char g, unsigned char b) {
     uint16_t R = static_cast<uint16_t>(r >> 3);
     uint16_t G = static_cast<uint16_t>(g >> 2);
@@ -102,6 +186,57 @@ int main() {
         return 1;
     }
 
+    // Header probe: size/format without decoding
+    auto info = core::probe_image(path);
+    if (!info || info->width != 2 || info->height != 2 || info->format != core::ImageFormat::BMP) {
+        std::cerr << "[FAIL] probe_image\n";
+        return 22;
+    }
+    // Over the configured limit -> stb still decodes it whole and downscales; past 4x the
+    // limit it is rejected before decoding (header claims 100x100, no pixel data behind it)
+    core::set_image_max_dimensions(1, 1);
+    {
+        std::ifstream bf(path, std::ios::binary);
+        std::vector<unsigned char> huge((std::istreambuf_iterator<char>(bf)), std::istreambuf_iterator<char>());
+        huge[18] = 100; // biWidth
+        huge[22] = 100; // biHeight
+        const std::string huge_path = "/tmp/sliderui_test_img_huge.bmp";
+        const bool huge_ok = !write_bytes(huge_path, huge) || decode_to_texture(huge_path, 2, 2).has_value();
+        unlink(huge_path.c_str());
+        if (!decode_to_texture(path, 2, 2).has_value() || huge_ok) {
+            std::cerr << "[FAIL] image_max_dimensions not enforced\n";
+            return 23;
+        }
+    }
+    core::set_image_max_dimensions(0, 0);
+
+    // Registry: misnamed file is sniffed and decoded by the right backend
+    std::string misnamed = "/tmp/sliderui_test_img_bmp.png";
+    if (!write_2x2_bmp(misnamed, pixels) || !decode_to_texture(misnamed, 2, 2).has_value()) {
+        unlink(misnamed.c_str());
+        std::cerr << "[FAIL] misnamed bmp not decoded\n";
+        return 30;
+    }
+    unlink(misnamed.c_str());
+    // ... unless its format is not in platform.image_formats
+    core::set_enabled_image_formats({"png", "JPEG", "webp"});
+    if (decode_to_texture(path, 2, 2).has_value() || core::image_decoder_name(core::ImageFormat::BMP) != nullptr) {
+        std::cerr << "[FAIL] disabled format decoded\n";
+        return 31;
+    }
+    if (!core::image_format_enabled(core::ImageFormat::JPEG)) { std::cerr << "[FAIL] jpeg alias\n"; return 32; }
+    core::set_enabled_image_formats({});
+#ifdef HAVE_LIBJPEG
+    const std::string jpeg_backend = "libjpeg";
+#else
+    const std::string jpeg_backend = "stb";
+#endif
+    if (jpeg_backend != core::image_decoder_name(core::ImageFormat::JPEG) ||
+        std::string("stb") != core::image_decoder_name(core::ImageFormat::JPEG, true)) {
+        std::cerr << "[FAIL] decoder priority\n";
+        return 33;
+    }
+
     auto opt = decode_to_texture(path, 2, 2);
     unlink(path.c_str());
     if (!opt.has_value()) {
@@ -129,6 +264,328 @@ int main() {
     if (t.pixels[2] != e2) { std::cerr << "[FAIL] p2 mismatch\n"; return 7; }
     if (t.pixels[3] != e3) { std::cerr << "[FAIL] p3 mismatch\n"; return 8; }
 
+    // Area downscale: a 1-pixel black/white checkerboard averages to mid grey,
+    // where nearest sampling would keep only one of the two colors.
+    std::vector<unsigned char> checker(8 * 8 * 3);
+    for (int y = 0; y < 8; ++y)
+        for (int x = 0; x < 8; ++x)
+            for (int c = 0; c < 3; ++c)
+                checker[(y * 8 + x) * 3 + c] = ((x + y) & 1) ? 255 : 0;
+    auto down = resample_rgb_to_rgb565(checker.data(), 8, 8, 2, 2, ResampleFilter::AREA);
+    uint16_t grey = rgb565_from_rgb(128, 128, 128);
+    if (down.size() != 4) { std::cerr << "[FAIL] area size\n"; return 9; }
+    for (uint16_t px : down) {
+        if (px != grey) { std::cerr << "[FAIL] area average mismatch\n"; return 10; }
+    }
+    auto auto_down = resample_rgb_to_rgb565(checker.data(), 8, 8, 3, 3);
+    for (uint16_t px : auto_down) {
+        // non-integer ratio: still close to grey on every channel
+        int g6 = (px >> 5) & 0x3F;
+        if (g6 < 24 || g6 > 40) { std::cerr << "[FAIL] auto downscale not averaged\n"; return 11; }
+    }
+
+    // Bilinear upscale: black -> white ramp is monotonic and keeps the end points.
+    std::vector<unsigned char> ramp = {0, 0, 0, 255, 255, 255};
+    auto up = resample_rgb_to_rgb565(ramp.data(), 2, 1, 8, 1, ResampleFilter::BILINEAR);
+    if (up.size() != 8) { std::cerr << "[FAIL] bilinear size\n"; return 12; }
+    if (up.front() != rgb565_from_rgb(0, 0, 0) || up.back() != rgb565_from_rgb(255, 255, 255)) {
+        std::cerr << "[FAIL] bilinear end points\n";
+        return 13;
+    }
+    for (size_t i = 1; i < up.size(); ++i) {
+        if (((up[i] >> 5) & 0x3F) < ((up[i - 1] >> 5) & 0x3F)) {
+            std::cerr << "[FAIL] bilinear ramp not monotonic\n";
+            return 14;
+        }
+    }
+
+    // Uniform 1080p source stays exactly the same color at any size.
+    std::vector<unsigned char> flat(1920 * 1080 * 3);
+    for (size_t i = 0; i < flat.size(); i += 3) { flat[i] = 200; flat[i + 1] = 100; flat[i + 2] = 50; }
+    auto cover = resample_rgb_to_rgb565(flat.data(), 1920, 1080, 250, 141);
+    if (cover.size() != 250u * 141u) { std::cerr << "[FAIL] 1080p size\n"; return 15; }
+    for (uint16_t px : cover) {
+        if (px != rgb565_from_rgb(200, 100, 50)) { std::cerr << "[FAIL] 1080p color drift\n"; return 16; }
+    }
+
+    // DCT scale selection: smallest 1/8..1/1 reduction that still covers the target.
+    if (core::jpeg_scale_denom(1600, 1200, 200, 150) != 8 ||
+        core::jpeg_scale_denom(1600, 1200, 201, 150) != 4 ||
+        core::jpeg_scale_denom(1000, 1500, 200, 270) != 4 ||
+        core::jpeg_scale_denom(640, 480, 640, 480) != 1 ||
+        core::jpeg_scale_denom(1601, 1200, 201, 150) != 8 /* ceil(1601/8) == 201 */) {
+        std::cerr << "[FAIL] jpeg_scale_denom\n";
+        return 17;
+    }
+
+    // Decode planning: JPEG over the limit is reduced by DCT scaling (libjpeg) or rejected;
+    // other formats can only be rejected.
+    core::ImageInfo big;
+    big.width = 1600;
+    big.height = 1200;
+    big.format = core::ImageFormat::PNG;
+    core::set_image_max_dimensions(640, 480);
+    if (core::plan_decode_scale(big) != 0) { std::cerr << "[FAIL] oversized png accepted\n"; return 24; }
+    big.format = core::ImageFormat::JPEG;
+#ifdef HAVE_LIBJPEG
+    if (core::plan_decode_scale(big) != 4 || core::plan_decode_scale(big, 200, 150) != 8) {
+        std::cerr << "[FAIL] jpeg decode plan\n";
+        return 25;
+    }
+#else
+    if (core::plan_decode_scale(big) != 0) { std::cerr << "[FAIL] oversized jpeg accepted\n"; return 25; }
+#endif
+    core::set_image_max_dimensions(0, 0);
+
+#ifdef HAVE_LIBJPEG
+    std::string jpg = "/tmp/sliderui_test_img.jpg";
+    if (!write_solid_jpeg(jpg, 1600, 1200, 40, 160, 220)) { std::cerr << "[FAIL] cannot write jpeg\n"; return 18; }
+    std::ifstream jf(jpg, std::ios::binary);
+    std::vector<unsigned char> jbuf((std::istreambuf_iterator<char>(jf)), std::istreambuf_iterator<char>());
+    std::vector<unsigned char> rgb;
+    int jw = 0, jh = 0;
+    if (!core::decode_jpeg_scaled(jbuf.data(), jbuf.size(), 200, 150, rgb, jw, jh) || jw != 200 || jh != 150) {
+        std::cerr << "[FAIL] scaled jpeg decode size " << jw << "x" << jh << "\n";
+        return 19;
+    }
+    auto jt = decode_to_texture(jpg, 200, 270);
+    unlink(jpg.c_str());
+    // streamed MCU rows == whole scaled image resampled afterwards
+    std::vector<unsigned char> j270;
+    if (!core::decode_jpeg_scaled(jbuf.data(), jbuf.size(), 200, 270, j270, jw, jh) || !jt ||
+        resample_rgb_to_rgb565(j270.data(), jw, jh, 200, 270) != jt->pixels) {
+        std::cerr << "[FAIL] streamed jpeg differs from full decode\n";
+        return 26;
+    }
+    if (!jt || jt->pixels.size() != 200u * 270u) { std::cerr << "[FAIL] jpeg decode_to_texture\n"; return 20; }
+    uint16_t mid = jt->pixels[135 * 200 + 100];
+    int r5 = mid >> 11, g6 = (mid >> 5) & 0x3F, b5 = mid & 0x1F;
+    if (std::abs(r5 - 40 / 8) > 1 || std::abs(g6 - 160 / 4) > 1 || std::abs(b5 - 220 / 8) > 1) {
+        std::cerr << "[FAIL] jpeg color drift\n";
+        return 21;
+    }
+
+    // RGBA with a display-size hint and no limit: libjpeg has no alpha, so stb decodes at
+    // full size instead of the call failing
+    if (!write_solid_jpeg(jpg, 1600, 1600, 40, 160, 220)) { std::cerr << "[FAIL] cannot write jpeg\n"; return 51; }
+    std::ifstream qf(jpg, std::ios::binary);
+    std::vector<unsigned char> qbuf((std::istreambuf_iterator<char>(qf)), std::istreambuf_iterator<char>());
+    unlink(jpg.c_str());
+    std::vector<unsigned char> jrgba;
+    int qw = 0, qh = 0;
+    if (!core::decode_image_memory(qbuf.data(), qbuf.size(), 4, 200, 200, jrgba, qw, qh) ||
+        qw != 1600 || qh != 1600 || jrgba.size() != 1600u * 1600u * 4u) {
+        std::cerr << "[FAIL] rgba jpeg with size hint not decoded\n";
+        return 49;
+    }
+#endif
+
+    // Row-by-row feeding gives the same result as the whole-image call
+    {
+        std::vector<unsigned char> src(37 * 23 * 3);
+        for (size_t i = 0; i < src.size(); ++i) src[i] = static_cast<unsigned char>(i * 13);
+        for (auto f : {ResampleFilter::NEAREST, ResampleFilter::AREA, ResampleFilter::BILINEAR}) {
+            for (auto sz : {std::pair<int, int>{10, 7}, {80, 50}, {37, 9}}) {
+                std::vector<uint16_t> streamed(static_cast<size_t>(sz.first) * sz.second);
+                core::RowResampler rs(37, 23, sz.first, sz.second, streamed.data(), f);
+                for (int y = 0; y < 23; ++y) rs.push_row(&src[static_cast<size_t>(y) * 37 * 3]);
+                if (!rs.done() || streamed != resample_rgb_to_rgb565(src.data(), 37, 23, sz.first, sz.second, f)) {
+                    std::cerr << "[FAIL] RowResampler mismatch\n";
+                    return 27;
+                }
+            }
+        }
+    }
+
+#ifdef HAVE_LIBPNG
+    // Streaming libpng decode matches stb_image decode + resample
+    std::string png_path = "/tmp/sliderui_test_img.png";
+    if (!write_gradient_png(png_path, 300, 200)) { std::cerr << "[FAIL] cannot write png\n"; return 28; }
+    auto pt = decode_to_texture(png_path, 120, 80);
+    int pw = 0, ph = 0, pc = 0;
+    unsigned char *ref = stbi_load(png_path.c_str(), &pw, &ph, &pc, 3);
+    unlink(png_path.c_str());
+    if (!pt || !ref || resample_rgb_to_rgb565(ref, pw, ph, 120, 80) != pt->pixels) {
+        std::cerr << "[FAIL] streamed png differs from stb decode\n";
+        stbi_image_free(ref);
+        return 29;
+    }
+    stbi_image_free(ref);
+
+    // Over the default image_max_dimensions (640x480) a streamed PNG is downscaled, not
+    // refused: same texture as without the limit, RGB decodes come back fitted to the limit,
+    // RGBA ones (whole-image backend, within 4x the limit) at full size
+    if (!write_gradient_png(png_path, 960, 720)) { std::cerr << "[FAIL] cannot write png\n"; return 50; }
+    auto free_tex = decode_to_texture(png_path, 640, 480);
+    core::set_image_max_dimensions(640, 480);
+    auto limited_tex = decode_to_texture(png_path, 640, 480);
+    std::ifstream pf(png_path, std::ios::binary);
+    std::vector<unsigned char> pbuf((std::istreambuf_iterator<char>(pf)), std::istreambuf_iterator<char>());
+    std::vector<unsigned char> fitted, rgba;
+    int fw = 0, fh = 0, aw = 0, ah = 0;
+    const bool fitted_ok = core::decode_image_memory(pbuf.data(), pbuf.size(), 3, 0, 0, fitted, fw, fh);
+    const bool rgba_ok = core::decode_image_memory(pbuf.data(), pbuf.size(), 4, 0, 0, rgba, aw, ah);
+    core::set_image_max_dimensions(0, 0);
+    unlink(png_path.c_str());
+    if (!free_tex || !limited_tex || limited_tex->pixels.size() != 640u * 480u ||
+        limited_tex->pixels != free_tex->pixels) {
+        std::cerr << "[FAIL] oversized png not decoded at target size under the limit\n";
+        return 47;
+    }
+    if (!fitted_ok || fw != 640 || fh != 480 || fitted.size() != 640u * 480u * 3u ||
+        !rgba_ok || aw != 960 || ah != 720) {
+        std::cerr << "[FAIL] oversized png decode_image_memory under the limit\n";
+        return 48;
+    }
+#endif
+
+    // Batch decode: results line up with paths, failures stay empty
+    {
+        std::vector<std::string> batch;
+        for (int i = 0; i < 6; ++i) {
+            std::string p = "/tmp/sliderui_test_batch_" + std::to_string(i) + ".bmp";
+            std::vector<unsigned char> px = {static_cast<unsigned char>(i * 40), 0, 0, 0, 255, 0,
+                                             0, 0, 255, 255, 255, 255};
+            if (!write_2x2_bmp(p, px)) { std::cerr << "[FAIL] cannot write batch bmp\n"; return 39; }
+            batch.push_back(p);
+        }
+        batch.insert(batch.begin() + 2, "/tmp/sliderui_test_batch_missing.bmp");
+        auto many = core::decode_many(batch, 2, 2, ResampleFilter::AUTO, false, 3);
+        bool ok = many.size() == batch.size() && !many[2];
+        for (size_t i = 0; ok && i < batch.size(); ++i) {
+            if (i == 2) continue;
+            int n = static_cast<int>(i < 2 ? i : i - 1);
+            ok = many[i] && many[i]->pixels[0] == rgb565_from_rgb(static_cast<unsigned char>(n * 40), 0, 0);
+        }
+        for (const auto &p : batch) unlink(p.c_str());
+        if (!ok) { std::cerr << "[FAIL] decode_many\n"; return 40; }
+    }
+
+    // Pre-baked covers: QOI is lossless, RGB565 at the target size is copied as-is
+    {
+        std::vector<unsigned char> rgba(33 * 21 * 4);
+        for (size_t i = 0; i < rgba.size(); ++i) rgba[i] = static_cast<unsigned char>((i / 4 % 7 == 0) ? 9 : i * 31);
+        for (int ch : {3, 4}) {
+            std::vector<unsigned char> px;
+            for (size_t i = 0; i < rgba.size(); i += 4) px.insert(px.end(), &rgba[i], &rgba[i] + ch);
+            std::vector<unsigned char> qoi = core::encode_qoi(px.data(), 33, 21, ch);
+            std::vector<unsigned char> back;
+            int qw = 0, qh = 0;
+            if (qoi.empty() || !core::decode_image_memory(qoi.data(), qoi.size(), ch, 0, 0, back, qw, qh) ||
+                qw != 33 || qh != 21 || back != px) {
+                std::cerr << "[FAIL] qoi round trip (" << ch << " channels)\n";
+                return 34;
+            }
+        }
+        std::vector<uint16_t> baked(200 * 270);
+        for (size_t i = 0; i < baked.size(); ++i) baked[i] = static_cast<uint16_t>(i * 2654435761u >> 7);
+        std::string r565 = "/tmp/sliderui_test_img.r565";
+        if (!write_bytes(r565, core::encode_rgb565_raw(baked.data(), 200, 270))) {
+            std::cerr << "[FAIL] cannot write r565\n";
+            return 35;
+        }
+        auto info565 = core::probe_image(r565);
+        auto same = decode_to_texture(r565, 200, 270);
+        auto half = decode_to_texture(r565, 100, 135, ResampleFilter::NEAREST);
+        unlink(r565.c_str());
+        if (!info565 || info565->format != core::ImageFormat::RGB565 || info565->width != 200 ||
+            !same || same->pixels != baked) {
+            std::cerr << "[FAIL] rgb565 fast path\n";
+            return 36;
+        }
+        // resized: decoded through RGB888 -> same as resampling the expanded pixels
+        std::vector<unsigned char> expanded;
+        for (uint16_t p : baked) {
+            unsigned r = p >> 11, g = (p >> 5) & 0x3F, b = p & 0x1F;
+            expanded.push_back(static_cast<unsigned char>((r << 3) | (r >> 2)));
+            expanded.push_back(static_cast<unsigned char>((g << 2) | (g >> 4)));
+            expanded.push_back(static_cast<unsigned char>((b << 3) | (b >> 2)));
+        }
+        if (!half || half->pixels != resample_rgb_to_rgb565(expanded.data(), 200, 270, 100, 135, ResampleFilter::NEAREST)) {
+            std::cerr << "[FAIL] resized rgb565\n";
+            return 37;
+        }
+        // truncated payload is rejected by the header check
+        std::vector<unsigned char> cut = core::encode_rgb565_raw(baked.data(), 200, 270);
+        cut.resize(cut.size() - 2);
+        core::CoverHeader hdr;
+        if (core::parse_rgb565_header(cut.data(), cut.size(), hdr)) {
+            std::cerr << "[FAIL] truncated rgb565 accepted\n";
+            return 38;
+        }
+    }
+
+    // Fit/fill: aspect kept, letterboxed or center-cropped into the slot
+    {
+        core::ScalePlan fit = core::plan_scale(400, 200, 100, 100, core::ScaleMode::FIT);
+        core::ScalePlan fill = core::plan_scale(400, 200, 100, 100, core::ScaleMode::FILL);
+        if (fit.dst_w != 100 || fit.dst_h != 50 || fit.dst_x != 0 || fit.dst_y != 25 || fit.crop_w != 400 ||
+            fill.crop_w != 200 || fill.crop_h != 200 || fill.crop_x != 100 || fill.dst_w != 100 || fill.dst_h != 100) {
+            std::cerr << "[FAIL] plan_scale\n";
+            return 41;
+        }
+        if (core::scale_mode_from_string("Fill") != core::ScaleMode::FILL ||
+            core::scale_mode_from_string("bogus") != core::ScaleMode::FIT) {
+            std::cerr << "[FAIL] scale_mode_from_string\n";
+            return 42;
+        }
+        // 4x2: red | green | green | blue columns
+        std::vector<unsigned char> wide;
+        for (int y = 0; y < 2; ++y) {
+            const unsigned char cols[4][3] = {{255, 0, 0}, {0, 255, 0}, {0, 255, 0}, {0, 0, 255}};
+            for (int x = 0; x < 4; ++x) wide.insert(wide.end(), cols[x], cols[x] + 3);
+        }
+        auto cropped = core::resample_rgb_scaled(wide.data(), 4, 2, 2, 2, core::ScaleMode::FILL, 0,
+                                                 ResampleFilter::NEAREST);
+        for (size_t i = 0; i < cropped.size(); i += 3) {
+            if (cropped[i] != 0 || cropped[i + 1] != 255 || cropped[i + 2] != 0) {
+                std::cerr << "[FAIL] fill center crop\n";
+                return 43;
+            }
+        }
+        std::string qoi_path = "/tmp/sliderui_test_wide.qoi";
+        if (!write_bytes(qoi_path, core::encode_qoi(wide.data(), 4, 2, 3))) { std::cerr << "[FAIL] write qoi\n"; return 44; }
+        auto boxed = decode_to_texture(qoi_path, 4, 4, ResampleFilter::NEAREST, false, core::ScaleMode::FIT);
+        unlink(qoi_path.c_str());
+        if (!boxed || boxed->pixels.size() != 16 || boxed->pixels[0] != 0 || boxed->pixels[15] != 0 ||
+            boxed->pixels[4] != rgb565_from_rgb(255, 0, 0) || boxed->pixels[11] != rgb565_from_rgb(0, 0, 255)) {
+            std::cerr << "[FAIL] fit letterbox\n";
+            return 45;
+        }
+    }
+
+    // Mip selection: nearest level that is not smaller than the draw size
+    if (core::mip_level_for(200, 270, 200, 270, 3) != 0 || core::mip_level_for(200, 270, 156, 210, 3) != 0 ||
+        core::mip_level_for(200, 270, 100, 135, 3) != 1 || core::mip_level_for(200, 270, 60, 80, 3) != 1 ||
+        core::mip_level_for(200, 270, 40, 50, 3) != 2 || core::mip_level_for(200, 270, 10, 10, 2) != 1) {
+        std::cerr << "[FAIL] mip_level_for\n";
+        return 46;
+    }
+
+    // A same-size pre-baked RGB565 cover reaches 16-bit surfaces bit-identical, even with
+    // dithering on; RGB565-sourced pixels are never dithered
+    {
+        std::vector<uint16_t> r565(8 * 8);
+        for (size_t i = 0; i < r565.size(); ++i) r565[i] = static_cast<uint16_t>(i * 2654435761u >> 7);
+        std::string r565_path = "/tmp/sliderui_test_cover.r565";
+        if (!write_bytes(r565_path, core::encode_rgb565_raw(r565.data(), 8, 8))) { std::cerr << "[FAIL] write r565\n"; return 52; }
+        core::ImageCache cache;
+        core::ImageData img = cache.get_scaled_image(r565_path, 8, 8);
+        unlink(r565_path.c_str());
+        std::vector<uint16_t> out(r565.size());
+        if (img.format != core::ImageFormat::RGB565 ||
+            !core::image_to_rgb565(img, reinterpret_cast<uint8_t *>(out.data()), 8 * 2, true) || out != r565) {
+            std::cerr << "[FAIL] r565 cover not copied bit-identical\n";
+            return 53;
+        }
+        img.rgb565.clear();
+        std::fill(out.begin(), out.end(), 0);
+        if (!core::image_to_rgb565(img, reinterpret_cast<uint8_t *>(out.data()), 8 * 2, true) || out != r565) {
+            std::cerr << "[FAIL] r565-sourced pixels dithered\n";
+            return 54;
+        }
+    }
+
     std::cout << "[OK] image_loader test passed\n";
     return 0;
 }
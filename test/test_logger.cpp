@@ -1,12 +1,18 @@
 #include "core/logger.h"
+#include <atomic>
 #include <iostream>
 #include <filesystem>
 #include <fstream>
+#include <set>
 #include <string>
+#include <thread>
+#include <vector>
 #include <unistd.h>
 
 namespace fs = std::filesystem;
 using core::Logger;
+using core::LogLevel;
+using core::LogSubsystem;
 
 static bool file_contains(const fs::path &p, const std::string &needle) {
   std::ifstream f(p);
@@ -64,6 +70,219 @@ int main() {
     return 5;
   }
 
+  // concurrent producers: every record must reach disk (ring is larger than the burst)
+  try { fs::remove_all(tmpdir); } catch (...) {}
+  if (!lg.init(tmpdir, 3, 1 << 20)) {
+    std::cerr << "[FAIL] logger re-init failed\n";
+    return 6;
+  }
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t) {
+    workers.emplace_back([&lg, t]() {
+      for (int i = 0; i < 40; ++i) lg.info("worker " + std::to_string(t) + " line " + std::to_string(i));
+    });
+  }
+  for (auto &w : workers) w.join();
+  lg.rotate_and_flush();
+  {
+    std::ifstream f(newest);
+    std::string line;
+    int lines = 0;
+    while (std::getline(f, line)) if (line.find("[INFO] worker ") != std::string::npos) ++lines;
+    if (lines != 160) {
+      std::cerr << "[FAIL] expected 160 concurrent records, got " << lines << "\n";
+      return 7;
+    }
+  }
+  if (!file_contains(newest, "worker 3 line 39")) {
+    std::cerr << "[FAIL] concurrent record missing\n";
+    return 8;
+  }
+
+  // re-init (ring file <-> text) while producers log: no crash, and every record ends up in
+  // log.0 exactly once or is counted by a "dropped" note (the ring file holds all of them)
+  try { fs::remove_all(tmpdir); } catch (...) {}
+  const size_t kBig = size_t(1) << 24;
+  const int kPerWorker = 2000;
+  if (!lg.init_ring(tmpdir, 3, 64 + 4 * kPerWorker * 256, kBig)) {
+    std::cerr << "[FAIL] logger init_ring (re-init race) failed\n";
+    return 26;
+  }
+  {
+    std::atomic<int> running{4};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t) {
+      producers.emplace_back([&lg, &running, t, kPerWorker]() {
+        for (int i = 0; i < kPerWorker; ++i) {
+          lg.info("reinit " + std::to_string(t) + " line " + std::to_string(i) + " end");
+          if (i % 64 == 0) std::this_thread::yield();
+        }
+        running.fetch_sub(1);
+      });
+    }
+    int reinits = 0;
+    bool ok = true;
+    while (running.load() > 0 || reinits < 4) {
+      ok = ok && ((reinits++ % 2) ? lg.init_ring(tmpdir, 3, 64 + 4 * kPerWorker * 256, kBig)
+                                  : lg.init(tmpdir, 3, 1024, kBig));
+    }
+    for (auto &p : producers) p.join();
+    if (!ok || !lg.init(tmpdir, 3, 1024, kBig)) {
+      std::cerr << "[FAIL] logger re-init during logging failed\n";
+      return 27;
+    }
+    lg.rotate_and_flush();
+    std::ifstream f(newest);
+    std::string line;
+    std::set<std::string> seen;
+    size_t records = 0, dropped = 0;
+    while (std::getline(f, line)) {
+      size_t at = line.find("[INFO] reinit ");
+      if (at != std::string::npos) {
+        ++records;
+        seen.insert(line.substr(at));
+      }
+      at = line.find("[LOGGER] dropped ");
+      if (at != std::string::npos) dropped += std::stoul(line.substr(at + 17));
+    }
+    if (records != seen.size() || seen.size() + dropped != 4u * kPerWorker) {
+      std::cerr << "[FAIL] re-init lost or duplicated records: " << seen.size() << " kept, " << dropped
+                << " dropped, " << records - seen.size() << " duplicated\n";
+      return 28;
+    }
+  }
+
+  // size-based rotation: log.0 is appended to and rotated once it would pass 300 bytes
+  try { fs::remove_all(tmpdir); } catch (...) {}
+  if (!lg.init(tmpdir, 3, 1024, 300)) {
+    std::cerr << "[FAIL] logger re-init (rotation) failed\n";
+    return 9;
+  }
+  for (int i = 0; i < 5; ++i) {
+    lg.info("rotation line " + std::to_string(i));
+    lg.rotate_and_flush(); // separate flushes must append, not truncate
+  }
+  if (!file_contains(newest, "rotation line 0") || !file_contains(newest, "rotation line 4")) {
+    std::cerr << "[FAIL] flushes did not append to log.0\n";
+    return 10;
+  }
+  for (int i = 5; i < 40; ++i) lg.info("rotation line " + std::to_string(i));
+  lg.rotate_and_flush();
+  for (int i = 0; i < 3; ++i) {
+    fs::path p = fs::path(tmpdir) / ("log." + std::to_string(i));
+    if (!fs::exists(p)) {
+      std::cerr << "[FAIL] expected rotated file " << p << "\n";
+      return 11;
+    }
+    if (fs::file_size(p) > 300) {
+      std::cerr << "[FAIL] " << p << " exceeds rotation size: " << fs::file_size(p) << "\n";
+      return 12;
+    }
+  }
+  if (fs::exists(fs::path(tmpdir) / "log.3")) {
+    std::cerr << "[FAIL] rotation kept more than max_files\n";
+    return 13;
+  }
+  if (!file_contains(newest, "rotation line 39")) {
+    std::cerr << "[FAIL] newest record missing from log.0\n";
+    return 14;
+  }
+
+  // level + subsystem filtering: disabled statements must not evaluate their message
+  try { fs::remove_all(tmpdir); } catch (...) {}
+  if (!lg.init(tmpdir, 3)) {
+    std::cerr << "[FAIL] logger re-init (levels) failed\n";
+    return 15;
+  }
+  int evaluated = 0;
+  auto msg = [&evaluated](const std::string &s) { ++evaluated; return s; };
+  lg.set_level(LogLevel::INFO);
+  lg.set_subsystem_mask(static_cast<uint32_t>(LogSubsystem::ALL) & ~static_cast<uint32_t>(LogSubsystem::RENDER));
+  LOG_TRACE(CORE, msg("filtered trace"));
+  LOG_DEBUG(CORE, msg("filtered debug"));
+  LOG_INFO(RENDER, msg("filtered render"));
+  if (evaluated != 0) {
+    std::cerr << "[FAIL] disabled log statements evaluated their arguments\n";
+    return 16;
+  }
+  LOG_INFO(CORE, msg("kept info"));
+  LOG_ERROR(SLIDER, msg("kept error"));
+  lg.set_level(LogLevel::TRACE);
+  LOG_TRACE(IMAGE, msg("kept trace"));
+  lg.rotate_and_flush();
+  if (evaluated != 3 || !file_contains(newest, "[INFO] kept info") ||
+      !file_contains(newest, "[ERROR] kept error") || !file_contains(newest, "[TRACE] kept trace") ||
+      file_contains(newest, "filtered")) {
+    std::cerr << "[FAIL] level/subsystem filtering wrote the wrong records\n";
+    return 17;
+  }
+  lg.set_subsystem_mask(static_cast<uint32_t>(LogSubsystem::ALL));
+  lg.set_level(LogLevel::INFO);
+
+  // timestamps: eager (cached prefix) and lazy (formatted by the flusher) share one format
+  lg.info("eager stamp");
+  lg.set_lazy_timestamps(true);
+  lg.info("lazy stamp");
+  lg.set_lazy_timestamps(false);
+  lg.rotate_and_flush();
+  {
+    std::ifstream f(newest);
+    std::string line;
+    int checked = 0;
+    while (std::getline(f, line)) {
+      if (line.find("stamp") == std::string::npos) continue;
+      // 2024-01-02T03:04:05.678Z [INFO] ...
+      bool shape = line.size() > 31 && line[4] == '-' && line[7] == '-' && line[10] == 'T' &&
+                   line[13] == ':' && line[16] == ':' && line[19] == '.' && line[23] == 'Z' &&
+                   line.compare(24, 8, " [INFO] ") == 0;
+      if (!shape) {
+        std::cerr << "[FAIL] malformed timestamp line: " << line << "\n";
+        return 18;
+      }
+      ++checked;
+    }
+    if (checked != 2) {
+      std::cerr << "[FAIL] expected eager and lazy stamp lines, got " << checked << "\n";
+      return 19;
+    }
+  }
+
+  // crash-safe ring file: records are readable from ring.bin without any flush
+  try { fs::remove_all(tmpdir); } catch (...) {}
+  if (!lg.init_ring(tmpdir, 3, 64 + 16 * 256)) { // 16 records
+    std::cerr << "[FAIL] logger init_ring failed\n";
+    return 20;
+  }
+  for (int i = 0; i < 20; ++i) lg.info("ring line " + std::to_string(i));
+  fs::path decoded = fs::path(tmpdir) / "decoded.txt";
+  if (!Logger::decode_ring((fs::path(tmpdir) / "ring.bin").string(), decoded.string())) {
+    std::cerr << "[FAIL] decode_ring failed\n";
+    return 21;
+  }
+  if (file_contains(decoded, "ring line 3\n") || !file_contains(decoded, "ring line 4\n") ||
+      !file_contains(decoded, "[INFO] ring line 19\n")) {
+    std::cerr << "[FAIL] ring file did not keep exactly the newest 16 records\n";
+    return 22;
+  }
+  {
+    std::ifstream f(decoded);
+    std::string first;
+    std::getline(f, first);
+    if (first.find("ring line 4") == std::string::npos) {
+      std::cerr << "[FAIL] decoded ring not in order: " << first << "\n";
+      return 23;
+    }
+  }
+  // leaving ring mode converts the ring into log.0
+  if (!lg.init(tmpdir, 3)) {
+    std::cerr << "[FAIL] logger re-init after ring failed\n";
+    return 24;
+  }
+  if (!file_contains(newest, "ring line 19")) {
+    std::cerr << "[FAIL] ring not exported to log.0\n";
+    return 25;
+  }
+
   // cleanup
   try { fs::remove_all(tmpdir); } catch (...) {}
 
@@ -0,0 +1,294 @@
+#include "core/pixel_convert.h"
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+using core::rgb888_to_rgb565_row;
+using core::rgb888_to_rgb565_row_scalar;
+using core::downsample_2x_32;
+using core::downsample_2x_32_scalar;
+using core::downsample_2x_565;
+using core::BlitFilter;
+using core::BlitRect;
+using core::scale_blit_16;
+using core::scale_blit_32;
+using core::scale_blit_32_scalar;
+using core::blend_argb_32;
+using core::blend_argb_32_scalar;
+using core::blend_argb_565;
+using core::blend_argb_565_scalar;
+using core::blend_color_32;
+using core::blend_color_32_scalar;
+using core::blend_color_565;
+using core::blend_color_565_scalar;
+
+int main() {
+    // Random row; odd lengths exercise the vector loop and the scalar tail.
+    std::vector<uint8_t> src(257 * 3);
+    uint32_t seed = 1;
+    for (auto &b : src) {
+        seed = seed * 1103515245u + 12345u;
+        b = static_cast<uint8_t>(seed >> 16);
+    }
+    // saturating corner cases
+    src[0] = src[1] = src[2] = 255;
+    src[3] = src[4] = src[5] = 0;
+
+    for (int count : {1, 7, 8, 9, 16, 17, 256, 257}) {
+        for (int dither = 0; dither < 2; ++dither) {
+            for (int row = 0; row < 4; ++row) {
+                std::vector<uint16_t> fast(count), ref(count);
+                rgb888_to_rgb565_row(src.data(), fast.data(), count, dither != 0, row, row + 1);
+                rgb888_to_rgb565_row_scalar(src.data(), ref.data(), count, dither != 0, row, row + 1);
+                if (fast != ref) {
+                    std::cerr << "[FAIL] simd/scalar mismatch count=" << count << " dither=" << dither << "\n";
+                    return 1;
+                }
+            }
+        }
+    }
+
+    // Without dithering: plain truncation.
+    const uint8_t px[3] = {0x12, 0x34, 0x56};
+    uint16_t out = 0;
+    rgb888_to_rgb565_row(px, &out, 1);
+    if (out != static_cast<uint16_t>(((0x12 >> 3) << 11) | ((0x34 >> 2) << 5) | (0x56 >> 3))) {
+        std::cerr << "[FAIL] truncation mismatch\n";
+        return 2;
+    }
+
+    // With dithering: a flat value between two RGB565 levels averages out over a 4x4 tile
+    // instead of collapsing to the lower level (banding).
+    std::vector<uint8_t> flat(4 * 3, 0);
+    for (int i = 0; i < 4; ++i) flat[i * 3 + 0] = 8 * 10 + 4; // red half way between 10 and 11
+    int sum = 0;
+    for (int row = 0; row < 4; ++row) {
+        uint16_t line[4];
+        rgb888_to_rgb565_row(flat.data(), line, 4, true, row);
+        for (uint16_t v : line) sum += v >> 11;
+    }
+    if (sum != 16 * 10 + 8) {
+        std::cerr << "[FAIL] dither average " << sum << "\n";
+        return 3;
+    }
+
+    // 2x2 box downsample: SIMD == scalar for odd sizes and padded pitches
+    for (auto sz : {std::pair<int, int>{1, 1}, {1, 5}, {6, 1}, {7, 3}, {17, 9}, {64, 33}}) {
+        const int sw = sz.first, sh = sz.second, spitch = sw * 4 + 12;
+        const int dw = sw > 1 ? sw / 2 : 1, dh = sh > 1 ? sh / 2 : 1, dpitch = dw * 4 + 4;
+        std::vector<uint8_t> img(static_cast<size_t>(spitch) * sh);
+        for (auto &b : img) {
+            seed = seed * 1103515245u + 12345u;
+            b = static_cast<uint8_t>(seed >> 16);
+        }
+        std::vector<uint8_t> fast(static_cast<size_t>(dpitch) * dh, 0), ref(fast.size(), 0);
+        downsample_2x_32(img.data(), sw, sh, spitch, fast.data(), dpitch);
+        downsample_2x_32_scalar(img.data(), sw, sh, spitch, ref.data(), dpitch);
+        if (fast != ref) {
+            std::cerr << "[FAIL] downsample simd/scalar mismatch " << sw << "x" << sh << "\n";
+            return 4;
+        }
+    }
+    // rounding: (1 + 2 + 3 + 4 + 2) >> 2 == 3 in every byte lane
+    const uint8_t quad[2 * 8] = {1, 1, 1, 1, 2, 2, 2, 2,
+                                 3, 3, 3, 3, 4, 4, 4, 4};
+    uint8_t one[4] = {0, 0, 0, 0};
+    downsample_2x_32(quad, 2, 2, 8, one, 4);
+    if (one[0] != 3 || one[3] != 3) {
+        std::cerr << "[FAIL] box average\n";
+        return 5;
+    }
+
+    // RGB565 box downsample rounds per channel like the 32-bit one
+    {
+        auto px = [](int r, int g, int b) { return static_cast<uint16_t>((r << 11) | (g << 5) | b); };
+        const uint16_t quad565[4] = {px(1, 10, 31), px(2, 20, 31), px(3, 30, 0), px(4, 63, 0)};
+        uint16_t one565 = 0;
+        downsample_2x_565(reinterpret_cast<const uint8_t *>(quad565), 2, 2, 4, reinterpret_cast<uint8_t *>(&one565), 2);
+        // r (1+2+3+4+2)>>2 = 3, g (10+20+30+63+2)>>2 = 31, b (31+31+0+0+2)>>2 = 16
+        if (one565 != px(3, 31, 16)) {
+            std::cerr << "[FAIL] downsample_2x_565 " << std::hex << one565 << "\n";
+            return 14;
+        }
+    }
+
+    // scaled blit: SIMD == scalar for up/down scales, odd sizes and clipped rectangles
+    {
+        const int sw = 37, sh = 23, spitch = sw * 4 + 8;
+        std::vector<uint8_t> img(static_cast<size_t>(spitch) * sh);
+        for (auto &b : img) {
+            seed = seed * 1103515245u + 12345u;
+            b = static_cast<uint8_t>(seed >> 16);
+        }
+        const int dw = 96, dh = 64, dpitch = dw * 4;
+        const BlitRect screen{0, 0, dw, dh};
+        const BlitRect cases[] = {{3, 5, 80, 50}, {0, 0, 17, 9}, {-20, -7, 61, 40}, {50, 30, 90, 70}, {10, 10, 37, 23}};
+        for (const BlitRect &to : cases) {
+            for (BlitFilter f : {BlitFilter::NEAREST, BlitFilter::BILINEAR}) {
+                std::vector<uint8_t> fast(static_cast<size_t>(dpitch) * dh, 0), ref(fast.size(), 0);
+                scale_blit_32(img.data(), sw, sh, spitch, fast.data(), dpitch, to, screen, f);
+                scale_blit_32_scalar(img.data(), sw, sh, spitch, ref.data(), dpitch, to, screen, f);
+                if (fast != ref) {
+                    std::cerr << "[FAIL] scale_blit simd/scalar mismatch " << to.w << "x" << to.h << "\n";
+                    return 6;
+                }
+            }
+        }
+
+        // 1:1 reproduces the source exactly with both filters
+        for (BlitFilter f : {BlitFilter::NEAREST, BlitFilter::BILINEAR}) {
+            std::vector<uint8_t> out(static_cast<size_t>(sw) * 4 * sh, 0);
+            scale_blit_32(img.data(), sw, sh, spitch, out.data(), sw * 4, {0, 0, sw, sh}, {0, 0, sw, sh}, f);
+            for (int y = 0; y < sh; ++y) {
+                if (!std::equal(out.begin() + y * sw * 4, out.begin() + (y + 1) * sw * 4, img.begin() + y * spitch)) {
+                    std::cerr << "[FAIL] scale_blit 1:1 copy\n";
+                    return 7;
+                }
+            }
+        }
+
+        // clipping writes only inside the clip and doesn't shift the image
+        for (BlitFilter f : {BlitFilter::NEAREST, BlitFilter::BILINEAR}) {
+            const BlitRect to{4, 2, 70, 45}, clip{20, 10, 30, 20};
+            std::vector<uint8_t> full(static_cast<size_t>(dpitch) * dh, 0), part(full.size(), 0);
+            scale_blit_32(img.data(), sw, sh, spitch, full.data(), dpitch, to, screen, f);
+            scale_blit_32(img.data(), sw, sh, spitch, part.data(), dpitch, to, clip, f);
+            for (int y = 0; y < dh; ++y) {
+                for (int x = 0; x < dw; ++x) {
+                    const bool inside = x >= clip.x && x < clip.x + clip.w && y >= clip.y && y < clip.y + clip.h;
+                    for (int c = 0; c < 4; ++c) {
+                        const size_t i = static_cast<size_t>(y) * dpitch + x * 4 + c;
+                        if (part[i] != (inside ? full[i] : 0)) {
+                            std::cerr << "[FAIL] scale_blit clipping at " << x << "," << y << "\n";
+                            return 8;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // 2x upscale of two pixels: nearest duplicates, bilinear interpolates between them
+    {
+        const uint8_t two[8] = {0, 0, 0, 0, 200, 200, 200, 200};
+        uint8_t near4[16] = {0}, lin4[16] = {0};
+        scale_blit_32(two, 2, 1, 8, near4, 16, {0, 0, 4, 1}, {0, 0, 4, 1}, BlitFilter::NEAREST);
+        scale_blit_32(two, 2, 1, 8, lin4, 16, {0, 0, 4, 1}, {0, 0, 4, 1}, BlitFilter::BILINEAR);
+        if (near4[0] != 0 || near4[4] != 0 || near4[8] != 200 || near4[12] != 200) {
+            std::cerr << "[FAIL] nearest upscale\n";
+            return 9;
+        }
+        // centres at source x = 0, 0.25, 0.75, 1 (clamped): 0, 50, 150, 200
+        if (lin4[0] != 0 || lin4[4] != 50 || lin4[8] != 150 || lin4[12] != 200) {
+            std::cerr << "[FAIL] bilinear upscale " << int(lin4[4]) << " " << int(lin4[8]) << "\n";
+            return 10;
+        }
+    }
+
+    // RGB565: 1:1 is exact, a flat colour stays flat at any scale, gradients interpolate
+    {
+        const int sw = 9, sh = 5;
+        std::vector<uint16_t> img(static_cast<size_t>(sw) * sh);
+        for (auto &p : img) {
+            seed = seed * 1103515245u + 12345u;
+            p = static_cast<uint16_t>(seed >> 16);
+        }
+        std::vector<uint16_t> out(img.size(), 0);
+        scale_blit_16(reinterpret_cast<const uint8_t *>(img.data()), sw, sh, sw * 2,
+                      reinterpret_cast<uint8_t *>(out.data()), sw * 2, {0, 0, sw, sh}, {0, 0, sw, sh});
+        if (out != img) {
+            std::cerr << "[FAIL] scale_blit_16 1:1 copy\n";
+            return 11;
+        }
+        const uint16_t flat[4] = {0xA5F3, 0xA5F3, 0xA5F3, 0xA5F3};
+        std::vector<uint16_t> big(13 * 7, 0);
+        scale_blit_16(reinterpret_cast<const uint8_t *>(flat), 2, 2, 4, reinterpret_cast<uint8_t *>(big.data()), 26,
+                      {0, 0, 13, 7}, {0, 0, 13, 7});
+        for (uint16_t p : big) {
+            if (p != 0xA5F3) {
+                std::cerr << "[FAIL] scale_blit_16 flat colour " << std::hex << p << "\n";
+                return 12;
+            }
+        }
+        const uint16_t ramp[2] = {0x0000, 0xFFFF};
+        uint16_t mid[3] = {0, 0, 0};
+        scale_blit_16(reinterpret_cast<const uint8_t *>(ramp), 2, 1, 4, reinterpret_cast<uint8_t *>(mid), 6,
+                      {0, 0, 3, 1}, {0, 0, 3, 1});
+        // middle sample sits half way: every channel at (about) half intensity
+        if ((mid[1] >> 11) < 14 || (mid[1] >> 11) > 17 || ((mid[1] >> 5) & 63) < 29 || ((mid[1] >> 5) & 63) > 34) {
+            std::cerr << "[FAIL] scale_blit_16 interpolation " << std::hex << mid[1] << "\n";
+            return 13;
+        }
+    }
+
+    // Alpha blending: SIMD matches scalar for odd widths, with and without a coverage mask
+    {
+        const int bw = 19, bh = 3;
+        std::vector<uint8_t> base32(static_cast<size_t>(bw) * bh * 4), argb(base32.size()), mask(static_cast<size_t>(bw) * bh);
+        for (auto *v : {&base32, &argb, &mask}) {
+            for (auto &b : *v) {
+                seed = seed * 1103515245u + 12345u;
+                b = static_cast<uint8_t>(seed >> 16);
+            }
+        }
+        argb[3] = 0;   // fully transparent and fully opaque source pixels
+        argb[7] = 255;
+        std::vector<uint16_t> base16(static_cast<size_t>(bw) * bh);
+        for (size_t i = 0; i < base16.size(); ++i) base16[i] = static_cast<uint16_t>(base32[i * 2] | (base32[i * 2 + 1] << 8));
+
+        for (int w : {1, 3, 4, 7, 8, 9, 19}) {
+            for (int masked = 0; masked < 2; ++masked) {
+                const uint8_t *m = masked ? mask.data() : nullptr;
+                std::vector<uint8_t> a = base32, b = base32;
+                blend_color_32(a.data(), bw * 4, w, bh, 0x80336699u, 160, m, bw);
+                blend_color_32_scalar(b.data(), bw * 4, w, bh, 0x80336699u, 160, m, bw);
+                std::vector<uint16_t> c = base16, d = base16;
+                blend_color_565(reinterpret_cast<uint8_t *>(c.data()), bw * 2, w, bh, 0x3193, 160, m, bw);
+                blend_color_565_scalar(reinterpret_cast<uint8_t *>(d.data()), bw * 2, w, bh, 0x3193, 160, m, bw);
+                if (a != b || c != d) {
+                    std::cerr << "[FAIL] blend_color simd/scalar mismatch w=" << w << " mask=" << masked << "\n";
+                    return 15;
+                }
+            }
+            std::vector<uint8_t> a = base32, b = base32;
+            blend_argb_32(argb.data(), bw * 4, a.data(), bw * 4, w, bh);
+            blend_argb_32_scalar(argb.data(), bw * 4, b.data(), bw * 4, w, bh);
+            std::vector<uint16_t> c = base16, d = base16;
+            blend_argb_565(argb.data(), bw * 4, reinterpret_cast<uint8_t *>(c.data()), bw * 2, w, bh);
+            blend_argb_565_scalar(argb.data(), bw * 4, reinterpret_cast<uint8_t *>(d.data()), bw * 2, w, bh);
+            if (a != b || c != d) {
+                std::cerr << "[FAIL] blend_argb simd/scalar mismatch w=" << w << "\n";
+                return 16;
+            }
+            if (w > 1 && (a[0] != base32[0] || a[4] != argb[4] || a[5] != argb[5] || a[6] != argb[6])) {
+                std::cerr << "[FAIL] blend_argb alpha 0 / 255\n";
+                return 17;
+            }
+        }
+
+        // alpha 255 replaces, alpha 0 keeps, 128 lands half way: (200*129 + 100*127 + 128) >> 8 = 150
+        uint32_t px = 0xFF646464u;
+        blend_color_32(reinterpret_cast<uint8_t *>(&px), 4, 1, 1, 0x00C8C8C8u, 0);
+        uint32_t full = px;
+        blend_color_32(reinterpret_cast<uint8_t *>(&full), 4, 1, 1, 0x00C8C8C8u, 255);
+        uint32_t half = px;
+        blend_color_32(reinterpret_cast<uint8_t *>(&half), 4, 1, 1, 0x00C8C8C8u, 128);
+        if (px != 0xFF646464u || full != 0x00C8C8C8u || (half & 0xFF) != 150) {
+            std::cerr << "[FAIL] blend_color endpoints " << std::hex << px << " " << full << " " << half << "\n";
+            return 18;
+        }
+        // a mask byte of 0 leaves the pixel alone even at full alpha
+        uint16_t p565[2] = {0x1234, 0x1234};
+        const uint8_t cover[2] = {0, 255};
+        blend_color_565(reinterpret_cast<uint8_t *>(p565), 4, 2, 1, 0xFFFF, 255, cover, 2);
+        if (p565[0] != 0x1234 || p565[1] != 0xFFFF) {
+            std::cerr << "[FAIL] blend_color_565 mask " << std::hex << p565[0] << " " << p565[1] << "\n";
+            return 19;
+        }
+    }
+
+    std::cout << "[OK] pixel_convert test passed\n";
+    return 0;
+}
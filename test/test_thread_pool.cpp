@@ -0,0 +1,60 @@
+#include "core/thread_pool.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using core::ThreadPool;
+
+int main() {
+    ThreadPool pool(4);
+    if (pool.size() != 4) { std::cerr << "[FAIL] pool size\n"; return 1; }
+
+    // submit() returns the task's value through the future
+    auto f = pool.submit([] { return 6 * 7; });
+    if (f.get() != 42) { std::cerr << "[FAIL] submit result\n"; return 2; }
+
+    // parallel_for visits every index exactly once
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallel_for(hits.size(), [&](size_t i) { hits[i].fetch_add(1); });
+    for (auto &h : hits) {
+        if (h.load() != 1) { std::cerr << "[FAIL] parallel_for coverage\n"; return 3; }
+    }
+
+    // max_parallel caps concurrent items (caller included)
+    std::atomic<int> running{0}, peak{0};
+    pool.parallel_for(32, [&](size_t) {
+        int now = running.fetch_add(1) + 1;
+        int p = peak.load();
+        while (now > p && !peak.compare_exchange_weak(p, now)) {}
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        running.fetch_sub(1);
+    }, 2);
+    if (peak.load() > 2) { std::cerr << "[FAIL] concurrency limit exceeded: " << peak.load() << "\n"; return 4; }
+    if (peak.load() < 2) { std::cerr << "[FAIL] no overlap with limit 2\n"; return 5; }
+
+    // nested parallel_for from every worker completes (no deadlock on a saturated pool)
+    std::atomic<int> inner{0};
+    pool.parallel_for(8, [&](size_t) {
+        pool.parallel_for(8, [&](size_t) { inner.fetch_add(1); });
+    }, 8);
+    if (inner.load() != 64) { std::cerr << "[FAIL] nested parallel_for\n"; return 6; }
+
+    // exceptions reach the caller after all items ran
+    std::atomic<int> ran{0};
+    bool caught = false;
+    try {
+        pool.parallel_for(16, [&](size_t i) {
+            ran.fetch_add(1);
+            if (i == 3) throw std::runtime_error("boom");
+        });
+    } catch (const std::runtime_error &) {
+        caught = true;
+    }
+    if (!caught || ran.load() != 16) { std::cerr << "[FAIL] exception propagation\n"; return 7; }
+
+    std::cout << "[OK] thread_pool test passed\n";
+    return 0;
+}
@@ -0,0 +1,139 @@
+// tools/cover_convert.cpp
+//
+// Host-side converter that pre-bakes cover art into the fast-path formats read by
+// decode_to_texture / ImageCache (see core/cover_formats.h):
+//
+//   cover_convert [--format qoi|rgb565] [--size WxH] [--filter auto|nearest|area|bilinear]
+//                 [--dither] <input> <output>
+//
+// The format defaults to the output extension (.qoi / .r565). With --size the image is
+// resampled to exactly WxH (use the on-screen cover size so the device can blit RGB565
+// files without touching the pixels). Alpha is kept for QOI when no resize is requested.
+// Build with `make tools`.
+
+#include "core/cover_formats.h"
+#include "core/file_utils.h"
+#include "core/image_loader.h"
+#include "core/pixel_convert.h"
+
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace core;
+
+static void usage() {
+  std::fprintf(stderr,
+               "usage: cover_convert [--format qoi|rgb565] [--size WxH] "
+               "[--filter auto|nearest|area|bilinear] [--dither] <input> <output>\n");
+}
+
+static bool ends_with(const std::string &s, const char *suffix) {
+  size_t n = std::strlen(suffix);
+  return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+static bool parse_filter(const std::string &name, ResampleFilter &out) {
+  if (name == "auto") out = ResampleFilter::AUTO;
+  else if (name == "nearest") out = ResampleFilter::NEAREST;
+  else if (name == "area") out = ResampleFilter::AREA;
+  else if (name == "bilinear") out = ResampleFilter::BILINEAR;
+  else return false;
+  return true;
+}
+
+int main(int argc, char **argv) {
+  std::string format, in_path, out_path;
+  int tgt_w = 0, tgt_h = 0;
+  ResampleFilter filter = ResampleFilter::AUTO;
+  bool dither = false;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string a = argv[i];
+    if (a == "--format" && i + 1 < argc) {
+      format = argv[++i];
+    } else if (a == "--size" && i + 1 < argc) {
+      if (std::sscanf(argv[++i], "%dx%d", &tgt_w, &tgt_h) != 2 || tgt_w <= 0 || tgt_h <= 0) {
+        std::fprintf(stderr, "cover_convert: bad --size '%s'\n", argv[i]);
+        return 2;
+      }
+    } else if (a == "--filter" && i + 1 < argc) {
+      if (!parse_filter(argv[++i], filter)) {
+        std::fprintf(stderr, "cover_convert: unknown filter '%s'\n", argv[i]);
+        return 2;
+      }
+    } else if (a == "--dither") {
+      dither = true;
+    } else if (!a.empty() && a[0] == '-') {
+      usage();
+      return 2;
+    } else if (in_path.empty()) {
+      in_path = a;
+    } else if (out_path.empty()) {
+      out_path = a;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  if (in_path.empty() || out_path.empty()) {
+    usage();
+    return 2;
+  }
+  if (format.empty()) {
+    if (ends_with(out_path, ".qoi")) format = "qoi";
+    else if (ends_with(out_path, ".r565")) format = "rgb565";
+  }
+  if (format != "qoi" && format != "rgb565") {
+    std::fprintf(stderr, "cover_convert: pick --format qoi|rgb565 (or use a .qoi/.r565 output)\n");
+    return 2;
+  }
+
+  file_utils::MappedFile file;
+  if (!file.open(in_path)) {
+    std::fprintf(stderr, "cover_convert: cannot read %s\n", in_path.c_str());
+    return 1;
+  }
+  std::optional<ImageInfo> info = probe_image_memory(file.data(), file.size());
+  if (!info) {
+    std::fprintf(stderr, "cover_convert: %s is not a supported image\n", in_path.c_str());
+    return 1;
+  }
+  const bool resize = tgt_w > 0 && (tgt_w != info->width || tgt_h != info->height);
+  const int channels = (format == "qoi" && !resize && info->channels == 4) ? 4 : 3;
+
+  std::vector<unsigned char> px;
+  int w = 0, h = 0;
+  // Ask for at least the target size so a scaling decoder can shrink big JPEGs first.
+  if (!decode_image_memory(file.data(), file.size(), channels, tgt_w, tgt_h, px, w, h, in_path)) {
+    std::fprintf(stderr, "cover_convert: failed to decode %s\n", in_path.c_str());
+    return 1;
+  }
+  file.close();
+  if (tgt_w > 0 && (w != tgt_w || h != tgt_h)) {
+    px = resample_rgb(px.data(), w, h, tgt_w, tgt_h, filter);
+    w = tgt_w;
+    h = tgt_h;
+  }
+
+  std::vector<unsigned char> encoded;
+  if (format == "qoi") {
+    encoded = encode_qoi(px.data(), w, h, channels);
+  } else {
+    std::vector<uint16_t> rgb565(static_cast<size_t>(w) * static_cast<size_t>(h));
+    for (int y = 0; y < h; ++y)
+      rgb888_to_rgb565_row(px.data() + static_cast<size_t>(y) * w * 3, rgb565.data() + static_cast<size_t>(y) * w,
+                           w, dither, y);
+    encoded = encode_rgb565_raw(rgb565.data(), w, h);
+  }
+  if (encoded.empty() ||
+      !file_utils::atomic_write(out_path, std::string(encoded.begin(), encoded.end()))) {
+    std::fprintf(stderr, "cover_convert: failed to write %s\n", out_path.c_str());
+    return 1;
+  }
+  std::printf("%s -> %s (%s %dx%d, %zu bytes)\n", in_path.c_str(), out_path.c_str(), format.c_str(), w, h,
+              encoded.size());
+  return 0;
+}